@@ -1,5 +1,6 @@
 #include "rubiks_cube.hpp"
 
+#include <string>
 #include <utility>
 
 #include "../engine/debug/logger.hpp"
@@ -32,6 +33,7 @@ RubiksCube::RubiksCube(engine::scene::Node& node) {
         color_config.front = z == 2 ? orange : black;
 
         _pieces[z][y][x] = std::experimental::make_observer(&node.add_child());
+        _pieces[z][y][x]->set_name("piece_" + std::to_string(x) + "_" + std::to_string(y) + "_" + std::to_string(z));
         _pieces[z][y][x]->add_component<RubiksCubePiece>(*_pieces[z][y][x], geometry::Transform(pos), color_config);
         _pieces[z][y][x]->add_component<engine::geometry::Transform>(pos);
       }
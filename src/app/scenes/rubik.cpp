@@ -64,6 +64,7 @@ Rubik::Rubik(engine::scene::SceneAPI& api,
   });
 
   _lines.add_component<graphics::component::LineSegments>(line_segments);
+  _lines.make_static();
 
   _cuboid1.add_component<geometry::Transform>(geometry::Vector<3>(0.5F, 0.5F, 0.5F),
                                               geometry::Orientation(),
@@ -83,14 +84,16 @@ Rubik::Rubik(engine::scene::SceneAPI& api,
   _cuboid3.add_component<graphics::component::Cuboid>(geometry::Transform(),
                                                       graphics::Color(1.0F, 0.6F, 0.6F));
 
+  _rubiks_cube.set_name("rubiks_cube");
   _rubiks_cube.add_component<geometry::Transform>(geometry::Vector<3>(-4.5F, 2, 4.5F));
   _rubiks_cube.add_component<RubiksCube>(_rubiks_cube);
 
+  // NOTE: The subscription removes the callback once this scene is unloaded.
   const auto& input = _api.input_manager();
-  input.on_key([&]([[maybe_unused]] const os::Window& window,
-                   engine::os::KeyCode keycode,
-                   engine::os::KeyAction action,
-                   const engine::os::ActivatedModifiers& mods) {
+  _on_key           = input.on_key([this]([[maybe_unused]] const os::Window& window,
+                                          engine::os::KeyCode keycode,
+                                          engine::os::KeyAction action,
+                                          const engine::os::ActivatedModifiers& mods) {
     if (action == os::KeyAction::PRESS) {
       auto& cube = _rubiks_cube.component<RubiksCube>();
 
@@ -110,6 +113,12 @@ Rubik::Rubik(engine::scene::SceneAPI& api,
   });
 }
 
+Rubik::~Rubik() {
+  // Don't leave the scene API with a dangling camera when this scene is unloaded.
+  if (_api.camera == (graphics::Camera*) _camera.get())
+    _api.camera = nullptr;
+}
+
 void Rubik::update(float delta_time) {
   static float time = 0.0F;
   time += delta_time;
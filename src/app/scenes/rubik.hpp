@@ -9,6 +9,12 @@ namespace app::scenes {
   class Rubik : public engine::scene::IScript {
   public:
     Rubik(engine::scene::SceneAPI& api, engine::scene::Node& root);
+    Rubik(const Rubik&) = delete;
+    Rubik(Rubik&&)      = delete;
+    ~Rubik() override;
+
+    auto operator=(const Rubik&) -> Rubik& = delete;
+    auto operator=(Rubik&&) -> Rubik& = delete;
 
     void update(float delta_time) override;
 
@@ -23,6 +29,8 @@ namespace app::scenes {
     engine::scene::Node& _rubiks_cube;
 
     std::unique_ptr<engine::debug::DebugCamera> _camera;
+
+    engine::architecture::Subscription _on_key;
   };
 
 }
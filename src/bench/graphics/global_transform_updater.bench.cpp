@@ -0,0 +1,60 @@
+#include "../util.hpp"
+
+#include "../../engine/geometry/transform.hpp"
+#include "../../engine/graphics/system/global_transform_updater.hpp"
+#include "../../engine/scene/component/node.hpp"
+#include "../../engine/scene/hierarchy.hpp"
+
+#include <iostream>
+
+using namespace engine;
+
+/// Builds a scene of \p subtrees independent subtrees, each with \p fanout children per node and \p depth levels below its root.
+static void build_scene(architecture::ECS& ecs, unsigned int subtrees, unsigned int fanout, unsigned int depth) {
+  auto root = ecs.create();
+  ecs.emplace<scene::component::Node>(root);
+
+  std::vector<architecture::EntityID> level;
+  for (unsigned int i = 0; i < subtrees; i++) {
+    auto e = ecs.create();
+    ecs.emplace<scene::component::Node>(e);
+    ecs.emplace<geometry::Transform>(e, geometry::Vector<3>((float) i, 0.0F, 0.0F));
+    scene::attach(ecs, root, e);
+    level.push_back(e);
+  }
+
+  for (unsigned int d = 0; d < depth; d++) {
+    std::vector<architecture::EntityID> next_level;
+    for (auto parent : level) {
+      for (unsigned int i = 0; i < fanout; i++) {
+        auto e = ecs.create();
+        ecs.emplace<scene::component::Node>(e);
+        ecs.emplace<geometry::Transform>(e, geometry::Vector<3>(0.0F, 1.0F, 0.0F), geometry::Rotation(0.0F, 0.1F, 0.0F));
+        scene::attach(ecs, parent, e);
+        next_level.push_back(e);
+      }
+    }
+    level = std::move(next_level);
+  }
+}
+
+BENCHMARK(GlobalTransformUpdaterScaling) {
+  for (unsigned int fanout : {4U, 16U}) {
+    architecture::ECS ecs;
+    build_scene(ecs, 16, fanout, 3);
+
+    std::cout << ecs.size<scene::component::Node>() << " nodes" << std::endl;
+
+    double single_threaded = 0.0;
+    for (unsigned int threads : {1U, 2U, 4U, 8U}) {
+      job::JobSystem jobs(threads - 1);
+      graphics::system::GlobalTransformUpdater updater(jobs);
+
+      double ms = bench::measure(20, [&] { updater.update(ecs); });
+      if (threads == 1)
+        single_threaded = ms;
+
+      std::cout << "  " << threads << " thread(s): " << ms << " ms/update, speedup " << single_threaded / ms << "x" << std::endl;
+    }
+  }
+}
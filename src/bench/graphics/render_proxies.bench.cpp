@@ -0,0 +1,57 @@
+#include "../util.hpp"
+
+#include "../../engine/graphics/component/cuboid.hpp"
+#include "../../engine/graphics/component/global_transform.hpp"
+#include "../../engine/graphics/component/render_proxies.hpp"
+#include "../../engine/graphics/system/render_proxy_builder.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+using namespace engine;
+
+/// Creates \p count cuboids whose GlobalTransform pool is ordered differently from their Cuboid pool, as it is in scenes where global transforms are emplaced in hierarchy order.
+static void build_scene(architecture::ECS& ecs, std::size_t count) {
+  std::vector<architecture::EntityID> entities(count);
+  ecs.create(entities.begin(), entities.end());
+  for (auto e : entities)
+    ecs.emplace<graphics::component::Cuboid>(e);
+
+  std::shuffle(entities.begin(), entities.end(), std::mt19937(42));
+  for (auto e : entities)
+    ecs.emplace<graphics::component::GlobalTransform>(e, geometry::Matrix<4>());
+}
+
+BENCHMARK(RenderProxies) {
+  constexpr std::size_t count = 100000;
+
+  architecture::ECS ecs;
+  build_scene(ecs, count);
+
+  auto view_projection = geometry::Matrix<4>();
+  float sink           = 0.0F; // Keeps the compiler from dropping the loops.
+
+  double joined = bench::measure(20, [&] {
+    auto view = ecs.view<graphics::component::Cuboid, graphics::component::GlobalTransform>();
+    for (auto entity : view) {
+      auto mvp = view_projection * view.get<graphics::component::GlobalTransform>(entity).matrix;
+      sink += mvp[0][0] + view.get<graphics::component::Cuboid>(entity).color.red();
+    }
+  });
+
+  graphics::system::RenderProxyBuilder builder;
+  double build = bench::measure(20, [&] { builder.update(ecs); });
+
+  auto& proxies = ecs.ctx<graphics::component::RenderProxies>();
+  double packed = bench::measure(20, [&] {
+    for (const auto& proxy : proxies.cuboids) {
+      auto mvp = view_projection * proxy.model;
+      sink += mvp[0][0] + proxy.color.red();
+    }
+  });
+
+  std::cout << "  " << count << " cuboids (" << sink << ")" << std::endl;
+  std::cout << "  joined component pools: " << joined << " ms/view" << std::endl;
+  std::cout << "  render proxies: " << packed << " ms/view + " << build << " ms/prepare" << std::endl;
+}
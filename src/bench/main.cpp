@@ -0,0 +1,27 @@
+#include "util.hpp"
+
+#include <iostream>
+
+auto bench::benchmarks() -> std::vector<Benchmark>& {
+  static std::vector<Benchmark> registered;
+  return registered;
+}
+
+bench::Registrar::Registrar(const std::string& name, const std::function<void()>& func) {
+  benchmarks().push_back({name, func});
+}
+
+/// Runs all benchmarks, or only those whose name contains the first argument.
+auto main(int argc, char** argv) -> int {
+  engine::debug::Logger::set_profile(engine::debug::Logger::Profile::DEV);
+
+  std::string filter = argc > 1 ? argv[1] : "";
+  for (auto& benchmark : bench::benchmarks()) {
+    if (benchmark.name.find(filter) == std::string::npos)
+      continue;
+
+    std::cout << "[ RUN      ] " << benchmark.name << std::endl;
+    benchmark.func();
+    std::cout << "[     DONE ] " << benchmark.name << std::endl;
+  }
+}
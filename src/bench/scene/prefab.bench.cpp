@@ -0,0 +1,51 @@
+#include "../util.hpp"
+
+#include "../../engine/geometry/transform.hpp"
+#include "../../engine/scene/prefab.hpp"
+
+#include <iostream>
+
+using namespace engine;
+
+/// Builds a cube of 3x3x3 pieces below entity \p parent, similar to the Rubik's cube of the app.
+static auto build_cube(architecture::ECS& ecs, architecture::EntityID parent) -> architecture::EntityID {
+  auto cube = ecs.create();
+  ecs.emplace<scene::component::Node>(cube);
+  ecs.emplace<geometry::Transform>(cube);
+  scene::attach(ecs, parent, cube);
+
+  for (int z = 0; z < 3; z++) {
+    for (int y = 0; y < 3; y++) {
+      for (int x = 0; x < 3; x++) {
+        auto piece = ecs.create();
+        ecs.emplace<scene::component::Node>(piece);
+        ecs.emplace<geometry::Transform>(piece, geometry::Vector<3>((float) x, (float) y, (float) z));
+        scene::attach(ecs, cube, piece);
+      }
+    }
+  }
+
+  return cube;
+}
+
+BENCHMARK(PrefabInstantiate) {
+  constexpr std::size_t copies = 10000;
+
+  double one_by_one = bench::measure(5, [&] {
+    architecture::ECS ecs;
+    auto root = ecs.create();
+    ecs.emplace<scene::component::Node>(root);
+    for (std::size_t i = 0; i < copies; i++)
+      build_cube(ecs, root);
+  });
+
+  double prefab = bench::measure(5, [&] {
+    architecture::ECS ecs;
+    auto root = ecs.create();
+    ecs.emplace<scene::component::Node>(root);
+    scene::Prefab::capture<geometry::Transform>(ecs, build_cube(ecs, root)).instantiate(ecs, root, copies);
+  });
+
+  std::cout << "  " << copies << " cubes one by one: " << one_by_one << " ms" << std::endl;
+  std::cout << "  " << copies << " cubes from a prefab: " << prefab << " ms" << std::endl;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../engine/debug/logger.hpp"
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+  struct Benchmark {
+    std::string name;
+    std::function<void()> func;
+  };
+
+  /// @brief All benchmarks registered through BENCHMARK().
+  auto benchmarks() -> std::vector<Benchmark>&;
+
+  struct Registrar {
+    Registrar(const std::string& name, const std::function<void()>& func);
+  };
+
+  /// @brief Calls \p func \p iterations times and returns the mean duration of a call in milliseconds.
+  template <typename F>
+  auto measure(unsigned int iterations, F func) -> double {
+    func(); // Warm up caches and lazily created state.
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+      func();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+  }
+
+}
+
+/// @brief Defines and registers a benchmark called \p name.
+#define BENCHMARK(name)                                         \
+  static void name();                                           \
+  static const bench::Registrar name##_registrar(#name, &name); \
+  static void name()
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "ecs.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::architecture {
+
+  /// @brief ComponentChanges collects the entities whose component of type \p T was added, updated, or removed since the last clear().
+  ///
+  /// It lets a system only process the entities that changed instead of scanning its whole view every update.
+  /// One instance is kept in the context of each ECS per \p Observer, usually the system type, so that several systems consume the same changes independently.
+  /// Use changes() to get it.
+  ///
+  /// Updates are only seen when they go through ECS::replace(), ECS::patch(), or ECS::emplace_or_replace(), not when a component is modified through a reference.
+  // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+  template <typename Observer, typename T>
+  class ComponentChanges {
+  public:
+    /// @brief Starts collecting the changes in \p ecs, where all existing components of type \p T count as added.
+    explicit ComponentChanges(ECS& ecs) {
+      for (auto entity : ecs.view<T>())
+        _added.insert(entity);
+
+      ecs.on_construct<T>().template connect<&ComponentChanges::on_construct>(*this);
+      ecs.on_update<T>().template connect<&ComponentChanges::on_update>(*this);
+      ecs.on_destroy<T>().template connect<&ComponentChanges::on_destroy>(*this);
+    }
+
+    ComponentChanges(const ComponentChanges&) = delete;
+    auto operator=(const ComponentChanges&) -> ComponentChanges& = delete;
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Forgets all collected changes, usually after the observer processed them.
+    void clear() {
+      _added.clear();
+      _updated.clear();
+      _removed.clear();
+    }
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Gets the entities that got a component of type \p T, and still have it.
+    [[nodiscard]] auto added() const -> const std::vector<EntityID>& {
+      return _added.entities;
+    }
+
+    /// @brief Gets the entities whose component of type \p T was updated, excluding those in added().
+    [[nodiscard]] auto updated() const -> const std::vector<EntityID>& {
+      return _updated.entities;
+    }
+
+    /// @brief Gets the entities whose component of type \p T was removed, excluding those that got it since the last clear().
+    [[nodiscard]] auto removed() const -> const std::vector<EntityID>& {
+      return _removed.entities;
+    }
+
+    [[nodiscard]] auto empty() const -> bool {
+      return _added.entities.empty() && _updated.entities.empty() && _removed.entities.empty();
+    }
+
+    /// @}
+
+  private:
+    /// An insertion ordered set of entities with constant time insertion and erasure.
+    struct EntitySet {
+      std::vector<EntityID> entities;
+      std::unordered_map<EntityID, std::size_t> indices;
+
+      auto contains(EntityID entity) const -> bool {
+        return indices.count(entity) != 0;
+      }
+
+      void insert(EntityID entity) {
+        if (indices.emplace(entity, entities.size()).second)
+          entities.push_back(entity);
+      }
+
+      auto erase(EntityID entity) -> bool {
+        auto it = indices.find(entity);
+        if (it == indices.end())
+          return false;
+
+        entities[it->second]     = entities.back();
+        indices[entities.back()] = it->second;
+        entities.pop_back();
+        indices.erase(entity);
+        return true;
+      }
+
+      void clear() {
+        entities.clear();
+        indices.clear();
+      }
+    };
+
+    /// @{
+    /// Private state.
+    EntitySet _added;
+    EntitySet _updated;
+    EntitySet _removed;
+    /// @}
+
+    void on_construct([[maybe_unused]] ECS& ecs, EntityID entity) {
+      _added.insert(entity);
+    }
+
+    void on_update([[maybe_unused]] ECS& ecs, EntityID entity) {
+      if (!_added.contains(entity))
+        _updated.insert(entity);
+    }
+
+    void on_destroy([[maybe_unused]] ECS& ecs, EntityID entity) {
+      _updated.erase(entity);
+      if (!_added.erase(entity))
+        _removed.insert(entity);
+    }
+  };
+
+  /// @brief Gets the changes to components of type \p T in \p ecs that \p Observer has not processed yet.
+  ///
+  /// The first call for an ECS starts collecting the changes, and reports all existing components as added.
+  template <typename Observer, typename T>
+  auto changes(ECS& ecs) -> ComponentChanges<Observer, T>& {
+    if (auto* existing = ecs.try_ctx<ComponentChanges<Observer, T>>(); existing != nullptr)
+      return *existing;
+    return ecs.set<ComponentChanges<Observer, T>>(ecs);
+  }
+
+}
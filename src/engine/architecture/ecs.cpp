@@ -1,7 +1,29 @@
 #include "ecs.hpp"
 
+#include <algorithm>
+
 using namespace engine::architecture;
 
+auto SystemAccess::conflicts_with(const SystemAccess& other) const -> bool {
+  if (_entries.empty() || other._entries.empty())
+    return true;
+
+  return std::any_of(_entries.begin(), _entries.end(), [&](const Entry& a) {
+    return std::any_of(other._entries.begin(), other._entries.end(), [&](const Entry& b) {
+      return a.type == b.type && (a.write || b.write);
+    });
+  });
+}
+
+void SystemAccess::prepare(ECS& ecs) const {
+  for (const auto& entry : _entries)
+    entry.prepare(ecs);
+}
+
 IEntitySystem::~IEntitySystem() = default;
 
+auto IEntitySystem::access() const -> SystemAccess {
+  return {};
+}
+
 IEntityComponent::~IEntityComponent() = default;
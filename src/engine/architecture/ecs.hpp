@@ -2,16 +2,94 @@
 
 #include <entt/entt.hpp>
 
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
 namespace engine::architecture {
   using ECS                       = entt::registry;
   using EntityID                  = entt::entity;
   constexpr EntityID NullEntityID = entt::null;
 
+  /// @brief SystemAccess declares which component types a system reads and writes.
+  ///
+  /// Systems whose accesses don't conflict may run concurrently.
+  /// A system that declares nothing is assumed to access everything, so it never runs concurrently with another system.
+  class SystemAccess {
+  public:
+    /// @brief Declares that the system reads the components of types \p T.
+    template <typename... T>
+    auto read() -> SystemAccess& {
+      (_entries.push_back({typeid(T), false, &prepare_pool<T>}), ...);
+      return *this;
+    }
+
+    /// @brief Declares that the system writes, emplaces, removes, or sorts the components of types \p T.
+    template <typename... T>
+    auto write() -> SystemAccess& {
+      (_entries.push_back({typeid(T), true, &prepare_pool<T>}), ...);
+      return *this;
+    }
+
+    /// @brief Declares that the system reads the variables of types \p T in the context of the ECS.
+    template <typename... T>
+    auto read_context() -> SystemAccess& {
+      (_entries.push_back({typeid(ContextVariable<T>), false, &prepare_context<T>}), ...);
+      return *this;
+    }
+
+    /// @brief Declares that the system writes or creates the variables of types \p T in the context of the ECS.
+    template <typename... T>
+    auto write_context() -> SystemAccess& {
+      (_entries.push_back({typeid(ContextVariable<T>), true, &prepare_context<T>}), ...);
+      return *this;
+    }
+
+    /// @brief Checks if a system with this access must not run concurrently with a system with access \p other.
+    [[nodiscard]] auto conflicts_with(const SystemAccess& other) const -> bool;
+
+    /// @brief Creates the pools of all declared component types and the declared context variables, since concurrent systems must not create them.
+    void prepare(ECS& ecs) const;
+
+  private:
+    struct Entry {
+      std::type_index type;
+      bool write;
+      void (*prepare)(ECS& ecs); //< creates the pool or context variable
+    };
+
+    /// Stands in for a variable of type \p T in the context of the ECS, so that it doesn't conflict with components of the same type.
+    template <typename T>
+    struct ContextVariable {};
+
+    template <typename T>
+    static void prepare_pool(ECS& ecs) {
+      ecs.reserve<T>(0);
+    }
+
+    /// Creates the variable, since concurrent systems must not add variables to the context either.
+    template <typename T>
+    static void prepare_context(ECS& ecs) {
+      if (ecs.try_ctx<T>() != nullptr)
+        return;
+
+      if constexpr (std::is_constructible_v<T, ECS&>)
+        ecs.set<T>(ecs);
+      else
+        ecs.set<T>();
+    }
+
+    std::vector<Entry> _entries;
+  };
+
   // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
   struct IEntitySystem {
     virtual ~IEntitySystem() = 0;
 
     virtual void update(ECS& ecs) = 0;
+
+    /// @brief Declares what the system accesses during update(), see SystemAccess.
+    [[nodiscard]] virtual auto access() const -> SystemAccess;
   };
 
   // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
@@ -0,0 +1,30 @@
+#include "event.hpp"
+
+using namespace engine::architecture;
+
+Subscription::Subscription(std::function<void()> unsubscribe)
+        : _unsubscribe(std::move(unsubscribe)) {}
+
+Subscription::Subscription(Subscription&& other) noexcept
+        : _unsubscribe(std::move(other._unsubscribe)) {
+  other._unsubscribe = nullptr;
+}
+
+Subscription::~Subscription() {
+  reset();
+}
+
+auto Subscription::operator=(Subscription&& other) noexcept -> Subscription& {
+  if (this != &other) {
+    reset();
+    _unsubscribe       = std::move(other._unsubscribe);
+    other._unsubscribe = nullptr;
+  }
+  return *this;
+}
+
+void Subscription::reset() {
+  if (_unsubscribe != nullptr)
+    _unsubscribe();
+  _unsubscribe = nullptr;
+}
@@ -2,28 +2,122 @@
 
 #include "eventpp/callbacklist.h"
 
-// THIS FILE IS NOT USED AT THE MOMENT
-// Maybe just use a typedef/using statement?
-
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <vector>
 
 namespace engine::architecture {
   namespace event = eventpp;
 
+  /// @brief Subscription removes a callback from the Event it listens to once it is destroyed or reset.
+  ///
+  /// Objects that listen with callbacks capturing `this` hold their subscriptions as members, so the callbacks can't outlive them.
+  /// It is safe to outlive the event, in which case there is nothing left to remove.
+  class Subscription {
+  public:
+    Subscription() = default;
+
+    /// @brief Creates a subscription that calls \p unsubscribe once it ends.
+    explicit Subscription(std::function<void()> unsubscribe);
+
+    Subscription(const Subscription&) = delete;
+    Subscription(Subscription&& other) noexcept;
+
+    ~Subscription();
+
+    auto operator=(const Subscription&) -> Subscription& = delete;
+    auto operator=(Subscription&& other) noexcept -> Subscription&;
+
+    /// @brief Removes the callback now, instead of when this subscription is destroyed.
+    void reset();
+
+  private:
+    std::function<void()> _unsubscribe;
+  };
+
+  /// @brief Event calls its listeners in the order they started to listen.
+  ///
+  /// Listeners may start or stop listening while the event is triggered. Those that start aren't called until the next trigger(), and those that stop aren't called anymore.
   template <class F>
   class Event {
+  public:
+    /// @brief Calls \p callback on every trigger() until the returned subscription ends.
+    [[nodiscard]] auto listen(std::function<F> callback) const -> Subscription {
+      // NOTE: Listeners are only added once no trigger is running, so that the callbacks don't move while they run.
+      auto id     = _listeners->next_id++;
+      auto& added = _listeners->triggering > 0 ? _listeners->added : _listeners->callbacks;
+      added.push_back({id, false, std::move(callback)});
 
-    void trigger() {
-      for (auto& c : _callbacks)
-        c();
+      return Subscription([listeners = std::weak_ptr<Listeners>(_listeners), id] {
+        if (auto l = listeners.lock())
+          l->remove(id);
+      });
     }
 
-    void listen(std::function<F> callback) const {
-      _callbacks.push_back(callback);
+    /// @brief Calls all listeners with \p args.
+    template <typename... Args>
+    void trigger(Args&&... args) {
+      // NOTE: Listeners are only erased once no trigger is running, so that a callback can't destroy itself while it runs.
+      struct Guard {
+        Listeners& listeners;
+        ~Guard() {
+          if (--listeners.triggering == 0)
+            listeners.settle();
+        }
+      } guard{*_listeners};
+      _listeners->triggering++;
+
+      for (auto& listener : _listeners->callbacks)
+        if (!listener.removed)
+          listener.callback(args...);
+    }
+
+    /// @brief Returns the number of listeners.
+    [[nodiscard]] auto size() const -> std::size_t {
+      std::size_t size = 0;
+      for (const auto* listeners : {&_listeners->callbacks, &_listeners->added})
+        for (const auto& listener : *listeners)
+          size += listener.removed ? 0 : 1;
+      return size;
     }
 
   private:
-    mutable std::vector<std::function<F>> _callbacks;
+    struct Listener {
+      std::uint64_t id;
+      bool removed;
+      std::function<F> callback;
+    };
+
+    /// Shared with the subscriptions, so that they can tell if the event still exists.
+    struct Listeners {
+      std::vector<Listener> callbacks;
+      std::vector<Listener> added; //< listeners that started during a trigger
+      std::uint64_t next_id   = 0;
+      unsigned int triggering = 0;
+
+      void remove(std::uint64_t id) {
+        for (auto* listeners : {&callbacks, &added})
+          for (auto& listener : *listeners)
+            if (listener.id == id)
+              listener.removed = true;
+
+        if (triggering == 0)
+          settle();
+      }
+
+      /// @brief Erases the listeners that stopped, and adds those that started during a trigger.
+      void settle() {
+        callbacks.erase(std::remove_if(callbacks.begin(), callbacks.end(), [](const auto& listener) { return listener.removed; }), callbacks.end());
+        for (auto& listener : added)
+          if (!listener.removed)
+            callbacks.push_back(std::move(listener));
+        added.clear();
+      }
+    };
+
+    std::shared_ptr<Listeners> _listeners = std::make_shared<Listeners>();
   };
 
 }
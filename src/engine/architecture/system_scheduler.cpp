@@ -0,0 +1,72 @@
+#include "system_scheduler.hpp"
+
+#include "../debug/logger.hpp"
+
+using namespace engine::architecture;
+
+SystemScheduler::SystemScheduler(job::JobSystem& jobs)
+        : _jobs(jobs) {}
+
+void SystemScheduler::add(std::string name, std::unique_ptr<IEntitySystem> system) {
+  auto access = system->access();
+
+  std::size_t wave = 0;
+  for (const auto& entry : _systems)
+    if (entry.wave >= wave && access.conflicts_with(entry.access))
+      wave = entry.wave + 1;
+
+  if (wave == _waves.size())
+    _waves.emplace_back();
+  _waves[wave].push_back(_systems.size());
+
+  _systems.push_back({std::move(system), std::move(access), wave});
+  _timings.push_back({std::move(name), 0});
+}
+
+void SystemScheduler::run(ECS& ecs) {
+  for (const auto& wave : _waves) {
+    if (wave.size() == 1) {
+      run_system(ecs, wave.front());
+      continue;
+    }
+
+    // Pools and context variables must not be created while other systems iterate them.
+    for (auto index : wave)
+      _systems[index].access.prepare(ecs);
+
+    _jobs.parallel_for(wave.size(), 1, [&](std::size_t begin, std::size_t end) {
+      for (auto i = begin; i < end; i++)
+        run_system(ecs, wave[i]);
+    });
+  }
+
+  log_timings();
+}
+
+auto SystemScheduler::timings() const -> const std::vector<Timing>& {
+  return _timings;
+}
+
+auto SystemScheduler::wave_count() const -> std::size_t {
+  return _waves.size();
+}
+
+void SystemScheduler::run_system(ECS& ecs, std::size_t index) {
+  auto start = std::chrono::steady_clock::now();
+  _systems[index].system->update(ecs);
+  auto end = std::chrono::steady_clock::now();
+
+  _timings[index].milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void SystemScheduler::log_timings() {
+  auto now = std::chrono::steady_clock::now();
+  if (now - _last_log < std::chrono::seconds(1))
+    return;
+
+  std::string s = "Systems:";
+  for (const auto& timing : _timings)
+    s += " " + timing.name + " " + std::to_string(timing.milliseconds) + " ms";
+  LOG_DEBUG(s);
+  _last_log = now;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "../job/job_system.hpp"
+#include "ecs.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace engine::architecture {
+
+  /// @brief SystemScheduler runs entity systems concurrently where their declared SystemAccess allows it.
+  ///
+  /// Systems run in the order they were added, unless they don't conflict with any earlier system they would wait for.
+  /// Each system is placed into the wave after the last wave that contains a conflicting system, and the systems of one wave run concurrently on the job system.
+  /// The timings of the systems are logged at debug level about once per second.
+  class SystemScheduler {
+  public:
+    /// @brief The duration of the last update of a system.
+    struct Timing {
+      std::string name;
+      double milliseconds = 0;
+    };
+
+    SystemScheduler(job::JobSystem& jobs);
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Adds \p system under \p name after all previously added systems it conflicts with.
+    void add(std::string name, std::unique_ptr<IEntitySystem> system);
+
+    /// @brief Updates all systems on \p ecs.
+    void run(ECS& ecs);
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Gets the timings of the last run, in the order the systems were added.
+    [[nodiscard]] auto timings() const -> const std::vector<Timing>&;
+
+    /// @brief Gets the number of waves, i.e. the length of the longest chain of conflicting systems.
+    [[nodiscard]] auto wave_count() const -> std::size_t;
+
+    /// @}
+
+  private:
+    struct Entry {
+      std::unique_ptr<IEntitySystem> system;
+      SystemAccess access;
+      std::size_t wave;
+    };
+
+    /// @{
+    /// Private state.
+    job::JobSystem& _jobs;
+    std::vector<Entry> _systems;
+    std::vector<std::vector<std::size_t>> _waves; //< indices into _systems
+    std::vector<Timing> _timings;
+    std::chrono::steady_clock::time_point _last_log = std::chrono::steady_clock::now();
+    /// @}
+
+    void run_system(ECS& ecs, std::size_t index);
+
+    /// @brief Logs the timings of the last run, unless they were logged less than a second ago.
+    void log_timings();
+  };
+
+}
@@ -15,15 +15,15 @@ DebugCamera::DebugCamera(const os::InputManager& input_manager, const geometry::
         : _camera(graphics::Camera(rigidbody)),
           _input_manager(input_manager) {
 
-  _input_manager.on_key([this](const os::Window& w, os::KeyCode k, os::KeyAction a, [[maybe_unused]] const os::ActivatedModifiers& mods) {
+  _on_key = _input_manager.on_key([this](const os::Window& w, os::KeyCode k, os::KeyAction a, [[maybe_unused]] const os::ActivatedModifiers& mods) {
     on_key(w, k, a);
   });
 
-  _input_manager.on_mouse_move([this](const os::Window& w, float x, float y) {
+  _on_mouse_move = _input_manager.on_mouse_move([this](const os::Window& w, float x, float y) {
     on_mouse_move(w, x, y);
   });
 
-  _input_manager.on_mouse_scroll([this](const os::Window& w, float x, float y) {
+  _on_mouse_scroll = _input_manager.on_mouse_scroll([this](const os::Window& w, float x, float y) {
     on_mouse_scroll(w, x, y);
   });
 }
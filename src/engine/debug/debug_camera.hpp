@@ -31,6 +31,11 @@ namespace engine::debug {
     bool _free_look_mode                      = false;
     float _zoom                               = 0.0F;
 
+    /// Declared last, so that the callbacks are removed before the state they use is destroyed.
+    architecture::Subscription _on_key;
+    architecture::Subscription _on_mouse_move;
+    architecture::Subscription _on_mouse_scroll;
+
     // Mutators
     void on_key(const os::Window& window, os::KeyCode keycode, os::KeyAction action);
     void on_mouse_move(const os::Window& window, float xpos, float ypos);
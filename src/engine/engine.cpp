@@ -7,36 +7,74 @@
 
 using namespace engine;
 
+namespace {
+
+  /// The index of the schedule that updates the scenes, after the one that polls events.
+  constexpr unsigned int update_schedule = 1;
+
+}
+
 NeonEngine::NeonEngine(Config config)
-        : _config(config) {
+        : _config(config),
+          _commands(config.command_capacity),
+          _tasks(std::chrono::nanoseconds((int) (1000000.0F * config.task_budget_ms))) {
 
   srand(std::time(nullptr));
   debug::Logger::set_profile(debug::Logger::Profile::DEBUG);
 
+  _jobs = std::make_unique<job::JobSystem>();
+
   _wm = std::make_unique<os::WindowManager>();
   _wm->on_all_windows_closed([this] {
     LOG_INFO("Stopping engine because all windows have been closed.");
     _is_running = false;
   });
 
-  _renderer = std::make_unique<graphics::Renderer>(*_wm);
+  _frames        = std::make_unique<graphics::FrameBuilder>(*_jobs);
+  _assets        = std::make_unique<graphics::AssetLoader>(*_jobs, _config.asset_uploads_per_frame);
+  _render_thread = std::make_unique<graphics::RenderThread>(*_wm, *_jobs, *_assets, std::chrono::nanoseconds((int) (1000000000.0F / _config.render_fps)));
 }
 
 void NeonEngine::set_scenes(std::vector<std::unique_ptr<scene::IFactory>> scenes) {
-  _scene_manager = std::make_unique<scene::Manager>(_wm->input_manager(), *_renderer, std::move(scenes));
+  auto publish   = [rt = _render_thread.get()](graphics::RenderSnapshot snapshot) { rt->publish(std::move(snapshot)); };
+  _scene_manager = std::make_unique<scene::Manager>(_wm->input_manager(), *_frames, publish, *_jobs, _tasks, *_assets, std::move(scenes));
 
   std::vector<time::UpdateScheduler::Schedule> schedules;
-  schedules.push_back({[sm = _scene_manager.get()](float dt) { sm->update(dt); },
-                       std::chrono::nanoseconds((int) (1000000000.0F / _config.ups)),
-                       true});
-  schedules.push_back({[sm = _scene_manager.get()]([[maybe_unused]] float dt) { sm->render(); },
-                       std::chrono::nanoseconds((int) (1000000000.0F / _config.render_fps)),
+
+  // Events are polled on every loop iteration, so input latency does not depend on the update or render rate.
+  // Input and tasks run here rather than with the scenes, so that they keep running while the time scale slows or pauses the simulation.
+  schedules.push_back({[this]([[maybe_unused]] float dt) {
+                         _commands.drain();
+                         _wm->poll_events();
+                         if (_wm->has_close_requests()) {
+                           auto frame = _render_thread->lock_frame();
+                           _wm->close_requested_windows();
+                         }
+                         _wm->dispatch_input_events();
+
+                         // Amortised work is capped at its budget per iteration, so that it does not cause hitches.
+                         _tasks.run();
+                       },
+                       std::chrono::nanoseconds::zero(),
                        false});
+  schedules.push_back({[this](float dt) {
+                         if (!_is_running)
+                           return;
+
+                         // Each update publishes a snapshot that the render thread draws while the next update runs.
+                         // It blends the snapshot with the previous update until the next one is due, so motion stays smooth between fixed updates.
+                         _scene_manager->update(dt, {std::chrono::steady_clock::now(), _game_loop->interpolation(update_schedule), _game_loop->step_interval(update_schedule)});
+                       },
+                       std::chrono::nanoseconds((int) (1000000000.0F / _config.ups)),
+                       true,
+                       true,
+                       _config.max_catch_up_steps,
+                       time::UpdateScheduler::Overflow::DROP});
   schedules.push_back({[sm = _scene_manager.get()]([[maybe_unused]] float dt) { sm->gui(); },
                        std::chrono::nanoseconds((int) (1000000000.0F / _config.gui_fps)),
                        false});
 
-  _game_loop = std::make_unique<time::UpdateScheduler>(std::move(schedules));
+  _game_loop = std::make_unique<time::UpdateScheduler>(std::move(schedules), std::chrono::nanoseconds((int) (1000000.0F * _config.spin_margin_ms)));
 }
 
 void NeonEngine::start() {
@@ -52,11 +90,24 @@ void NeonEngine::start() {
   LOG_INFO("Engine stopped.");
 }
 
+void NeonEngine::set_time_scale(float scale) {
+  if (_game_loop == nullptr)
+    LOG_ERROR("The time scale can only be set once the scenes are set.");
+
+  _game_loop->set_time_scale(scale);
+}
+
 void NeonEngine::stop() {
-  LOG_INFO("Stopping engine...");
-  _is_running = false;
+  _commands.push([this] {
+    LOG_INFO("Stopping engine...");
+    _is_running = false;
+  });
 }
 
 auto NeonEngine::is_running() const -> bool {
   return _is_running;
 }
+
+auto NeonEngine::dropped_ticks() const -> std::uint64_t {
+  return _game_loop != nullptr ? _game_loop->dropped_ticks() : 0;
+}
@@ -1,9 +1,16 @@
 #pragma once
 
+#include "graphics/frame_builder.hpp"
+#include "graphics/render_thread.hpp"
+#include "job/command_queue.hpp"
+#include "job/job_system.hpp"
 #include "scene/factory.hpp"
 #include "scene/manager.hpp"
+#include "time/task_queue.hpp"
 #include "time/update_scheduler.hpp"
 
+#include <atomic>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -16,27 +23,64 @@ namespace engine {
       float ups        = 100.0F;
       float render_fps = 60.0F;
       float gui_fps    = 30.0F;
+
+      unsigned int max_catch_up_steps = 5; //< updates that may run back to back when the engine falls behind, after which the rest of the lag is dropped
+
+      float spin_margin_ms = 0.5F; //< how long before an update is due the game loop stops sleeping and spins, which trades idle CPU time for punctuality
+      float task_budget_ms = 2.0F; //< time per loop iteration that may be spent on the steps of queued tasks, see time::TaskQueue
+
+      std::size_t command_capacity        = 256; //< commands that can be pending before submit() blocks
+      std::size_t asset_uploads_per_frame = 4;   //< loaded assets that the render thread uploads per frame, see graphics::AssetLoader
     };
 
     NeonEngine(Config config);
 
-    /// At first, only the scene at index 0 will be enabled.
+    /// At first, only the scene at index 0 will be loaded. Scripts load the others through SceneAPI::scene_manager().
     // void set_scenes(std::vector<std::unique_ptr<scene::IScene>> scenes);
     void set_scenes(std::vector<std::unique_ptr<scene::IFactory>> scenes);
 
     void start();
+
+    /// @brief Requests the engine to stop after its current update. Can be called from any thread.
     void stop();
 
+    /// @brief Speeds up or slows down the simulation by \p scale, e.g. 0.5 for slow motion, or pauses it with 0. Can be called from any thread.
+    ///
+    /// Scenes keep their fixed update step, and are updated more or less often instead. Input, commands, and the GUI are not affected.
+    void set_time_scale(float scale);
+
+    /// @brief Runs \p command on the engine thread at the start of the next loop iteration, before the scenes are updated, and returns a future of its result. Can be called from any thread.
+    ///
+    /// \p command is called with the scene manager, e.g. to load, unload, enable, or disable scenes.
+    /// Blocks while Config::command_capacity commands are pending.
+    template <typename F>
+    auto submit(F command) -> std::future<std::invoke_result_t<F, scene::Manager&>>;
+
     [[nodiscard]] auto is_running() const -> bool;
 
+    /// @brief Returns the number of updates that were skipped because the engine fell behind by more than Config::max_catch_up_steps updates.
+    [[nodiscard]] auto dropped_ticks() const -> std::uint64_t;
+
   private:
     Config _config;
-    bool _is_running = false;
+    std::atomic<bool> _is_running = false; //< only cleared on the engine thread, so the loop never stops in the middle of an update
+    job::CommandQueue _commands;
+    time::TaskQueue _tasks;
 
+    std::unique_ptr<job::JobSystem> _jobs;
     std::unique_ptr<os::WindowManager> _wm;
-    std::unique_ptr<graphics::Renderer> _renderer;
+    std::unique_ptr<graphics::FrameBuilder> _frames;
+    std::unique_ptr<graphics::AssetLoader> _assets;
+    std::unique_ptr<graphics::RenderThread> _render_thread;
     std::unique_ptr<scene::Manager> _scene_manager;
     std::unique_ptr<time::UpdateScheduler> _game_loop;
   };
 
+  template <typename F>
+  auto NeonEngine::submit(F command) -> std::future<std::invoke_result_t<F, scene::Manager&>> {
+    return _commands.submit([this, command = std::move(command)]() mutable {
+      return command(*_scene_manager);
+    });
+  }
+
 }
@@ -87,6 +87,9 @@ namespace engine::geometry {
     /// @brief This matrix but with all of its elements divided by \p scalar.
     auto operator/(float scalar) const -> Matrix<R, C>;
 
+    /// @brief The element-wise sum of this matrix and matrix \p other.
+    auto operator+(const Matrix<R, C>& other) const -> Matrix<R, C>;
+
     /// @brief This matrix multiplied with vector \p vector.
     template <bool U = false>
     auto operator*(const Vector<C, U>& vector) const -> Vector<R>;
@@ -359,6 +362,16 @@ namespace engine::geometry {
     return res;
   }
 
+  template <unsigned int R, unsigned int C>
+  auto Matrix<R, C>::operator+(const Matrix<R, C>& other) const -> Matrix<R, C> {
+    Matrix<R, C> res = *this;
+    for (unsigned int r = 0; r < R; r++)
+      for (unsigned int c = 0; c < C; c++)
+        res[r][c] += other[r][c];
+
+    return res;
+  }
+
   template <unsigned int R, unsigned int C>
   template <unsigned int C2>
   auto Matrix<R, C>::operator*(const Matrix<C, C2>& other) const -> Matrix<R, C2> {
@@ -0,0 +1,77 @@
+#include "transform_batch.hpp"
+
+#include <cmath>
+
+using namespace engine::geometry;
+
+void TransformBatch::resize(std::size_t size) {
+  for (unsigned int i = 0; i < 3; i++) {
+    _position[i].resize(size);
+    _rotation[i].resize(size);
+    _scale[i].resize(size);
+  }
+}
+
+void TransformBatch::set(std::size_t i, const Transform& transform) {
+  const auto& rotation = transform.orientation().rotation();
+  for (unsigned int axis = 0; axis < 3; axis++) {
+    _position[axis][i] = transform.position()[axis];
+    _scale[axis][i]    = transform.scale()[axis];
+  }
+  _rotation[0][i] = rotation.pitch().radians();
+  _rotation[1][i] = rotation.yaw().radians();
+  _rotation[2][i] = rotation.roll().radians();
+}
+
+void TransformBatch::set_identity(std::size_t i) {
+  for (unsigned int axis = 0; axis < 3; axis++) {
+    _position[axis][i] = 0.0F;
+    _rotation[axis][i] = 0.0F;
+    _scale[axis][i]    = 1.0F;
+  }
+}
+
+void TransformBatch::compute_matrices(std::size_t begin, std::size_t end, Matrix<4>* matrices) const {
+  // NOTE: Raw pointers keep the compiler from assuming that the vectors alias the output.
+  const float* __restrict px    = _position[0].data();
+  const float* __restrict py    = _position[1].data();
+  const float* __restrict pz    = _position[2].data();
+  const float* __restrict pitch = _rotation[0].data();
+  const float* __restrict yaw   = _rotation[1].data();
+  const float* __restrict roll  = _rotation[2].data();
+  const float* __restrict sx    = _scale[0].data();
+  const float* __restrict sy    = _scale[1].data();
+  const float* __restrict sz    = _scale[2].data();
+
+  for (std::size_t i = begin; i < end; i++) {
+    float cx = std::cos(pitch[i]);
+    float sn = std::sin(pitch[i]);
+    float cy = std::cos(yaw[i]);
+    float sw = std::sin(yaw[i]);
+    float cz = std::cos(roll[i]);
+    float sr = std::sin(roll[i]);
+
+    // The rotation matrix of Rotation::matrix() with its columns scaled, followed by the translation column.
+    auto& m = matrices[i];
+    m[0][0] = cy * cz * sx[i];
+    m[0][1] = (cz * sn * sw + cx * sr) * sy[i];
+    m[0][2] = (sn * sr - cx * cz * sw) * sz[i];
+    m[0][3] = px[i];
+    m[1][0] = -cy * sr * sx[i];
+    m[1][1] = (cx * cz - sn * sw * sr) * sy[i];
+    m[1][2] = (cz * sn + cx * sw * sr) * sz[i];
+    m[1][3] = py[i];
+    m[2][0] = sw * sx[i];
+    m[2][1] = -cy * sn * sy[i];
+    m[2][2] = cx * cy * sz[i];
+    m[2][3] = pz[i];
+    m[3][0] = 0.0F;
+    m[3][1] = 0.0F;
+    m[3][2] = 0.0F;
+    m[3][3] = 1.0F;
+  }
+}
+
+auto TransformBatch::size() const -> std::size_t {
+  return _position[0].size();
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "matrix.hpp"
+#include "transform.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace engine::geometry {
+
+  /// @brief TransformBatch stores many transforms as separate arrays of positions, rotations, and scales.
+  ///
+  /// Transform is convenient to work with one at a time, but computing its matrix goes through a virtual call and several intermediate matrices.
+  /// TransformBatch instead computes the matrices of a whole range of transforms in one pass over plain float arrays, which the compiler can vectorise.
+  class TransformBatch {
+  public:
+    /// @name Mutators
+    /// @{
+
+    /// @brief Resizes the batch to hold \p size transforms.
+    void resize(std::size_t size);
+
+    /// @brief Stores \p transform at index \p i.
+    void set(std::size_t i, const Transform& transform);
+
+    /// @brief Stores the identity transform at index \p i.
+    void set_identity(std::size_t i);
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Computes the matrices of the transforms in [\p begin, \p end) and writes them to \p matrices[begin, end).
+    ///
+    /// The results are equal to Transform::matrix().
+    void compute_matrices(std::size_t begin, std::size_t end, Matrix<4>* matrices) const;
+
+    [[nodiscard]] auto size() const -> std::size_t;
+
+    /// @}
+
+  private:
+    /// @{
+    /// Private state.
+    std::array<std::vector<float>, 3> _position; //< x, y, and z
+    std::array<std::vector<float>, 3> _rotation; //< pitch, yaw, and roll in radians
+    std::array<std::vector<float>, 3> _scale;    //< x, y, and z
+    /// @}
+  };
+
+}
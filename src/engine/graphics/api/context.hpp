@@ -11,6 +11,7 @@ namespace engine::graphics::api {
     virtual auto gen_vao() -> unsigned int            = 0;
     virtual auto vao(unsigned int id) -> unsigned int = 0;
     virtual auto is_vao(unsigned int id) -> bool      = 0;
+    virtual void delete_vao(unsigned int id)          = 0;
   };
 
   enum class GraphicsAPI {
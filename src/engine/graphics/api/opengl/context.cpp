@@ -50,3 +50,12 @@ auto Context::vao(unsigned int id) -> GLuint {
 auto Context::is_vao(unsigned int id) -> bool {
   return _vao_db.count(id) > 0;
 }
+
+void Context::delete_vao(unsigned int id) {
+  auto it = _vao_db.find(id);
+  if (it == _vao_db.end())
+    return;
+
+  glDeleteVertexArrays(1, &it->second);
+  _vao_db.erase(it);
+}
@@ -25,6 +25,8 @@ namespace engine::graphics::api::opengl {
     /// @todo Don't expose GLuint. Have them bind through us instead.
     auto vao(unsigned int id) -> GLuint override;
     auto is_vao(unsigned int id) -> bool override;
+    /// @brief Deletes the VAO with ID \p id of this context, if this context has created it.
+    void delete_vao(unsigned int id) override;
 
   private:
     static unsigned int _vao_count;
@@ -0,0 +1,87 @@
+#include "asset_loader.hpp"
+
+#include "gltf_model.hpp"
+#include "image.hpp"
+
+#include <algorithm>
+
+using namespace engine;
+using namespace engine::graphics;
+
+AssetLoader::AssetLoader(job::JobSystem& jobs, std::size_t uploads_per_frame)
+        : _jobs(jobs),
+          _uploads_per_frame(uploads_per_frame) {}
+
+AssetLoader::~AssetLoader() {
+  // NOTE: The decode jobs refer to this loader.
+  _jobs.wait(_decoding);
+}
+
+template <typename T, typename Decode, typename Create>
+auto AssetLoader::load(Decode decode, Create create) -> AssetHandle<T> {
+  auto promise = std::make_shared<std::promise<std::shared_ptr<T>>>();
+  AssetHandle<T> handle(promise->get_future());
+
+  auto job = [this, promise, decode = std::move(decode), create = std::move(create)] {
+    try {
+      // NOTE: std::function must be copyable, which the decoded data may not be.
+      auto decoded = std::make_shared<decltype(decode())>(decode());
+
+      const std::lock_guard<std::mutex> lock(_uploads_mutex);
+      _uploads.emplace_back([promise, decoded, create](Renderer& renderer) {
+        try {
+          promise->set_value(create(renderer, *decoded));
+        } catch (...) {
+          promise->set_exception(std::current_exception());
+        }
+      });
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  };
+  _jobs.run(job, _decoding);
+
+  return handle;
+}
+
+auto AssetLoader::load_texture(std::string img_path) -> AssetHandle<Texture> {
+  return load<Texture>(
+    [img_path] { return Image(img_path); },
+    [img_path]([[maybe_unused]] Renderer& renderer, const Image& image) {
+      return std::make_shared<Texture>(img_path, image);
+    });
+}
+
+auto AssetLoader::load_shader(std::string vertex_shader_path, std::string fragment_shader_path) -> AssetHandle<Shader> {
+  return load<Shader>(
+    [vertex_shader_path, fragment_shader_path] { return Shader::read_sources(vertex_shader_path, fragment_shader_path); },
+    [vertex_shader_path, fragment_shader_path]([[maybe_unused]] Renderer& renderer, const Shader::Sources& sources) {
+      return std::make_shared<Shader>(vertex_shader_path, fragment_shader_path, sources);
+    });
+}
+
+auto AssetLoader::load_model(std::string model_path, geometry::Transform transform, bool invert, GLTFFileFormat format) -> AssetHandle<GLTFModel> {
+  return load<GLTFModel>(
+    [model_path, format] { return GLTFModel::parse(model_path, format); },
+    [transform, invert](Renderer& renderer, tinygltf::Model& model) {
+      return std::make_shared<GLTFModel>(renderer, std::move(model), transform, invert);
+    });
+}
+
+void AssetLoader::finalise(Renderer& renderer) {
+  std::deque<std::function<void(Renderer&)>> batch;
+  {
+    const std::lock_guard<std::mutex> lock(_uploads_mutex);
+    auto count = std::min(_uploads_per_frame, _uploads.size());
+    batch.insert(batch.end(), std::make_move_iterator(_uploads.begin()), std::make_move_iterator(_uploads.begin() + count));
+    _uploads.erase(_uploads.begin(), _uploads.begin() + count);
+  }
+
+  for (auto& upload : batch)
+    upload(renderer);
+}
+
+auto AssetLoader::pending_uploads() const -> std::size_t {
+  const std::lock_guard<std::mutex> lock(_uploads_mutex);
+  return _uploads.size();
+}
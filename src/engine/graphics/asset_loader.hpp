@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../geometry/transform.hpp"
+#include "../job/job_system.hpp"
+#include "renderer.hpp"
+#include "shader.hpp"
+#include "texture.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace engine::graphics {
+
+  // NOTE: Declared here so that tinygltf is only included where models are created.
+  class GLTFModel;
+  enum class GLTFFileFormat;
+
+  /// @brief A handle to an asset that is loading, which can be polled with wait_for(0) or awaited with get().
+  ///
+  /// get() rethrows the error if the asset failed to load.
+  template <typename T>
+  using AssetHandle = std::shared_future<std::shared_ptr<T>>;
+
+  /// @brief AssetLoader loads textures, shaders, and models without blocking the simulation or the render thread.
+  ///
+  /// Files are read and decoded by jobs on the worker threads. The GPU uploads that finish an asset are queued for the render thread, which only does a bounded number of them per frame, see finalise().
+  // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+  class AssetLoader {
+  public:
+    /// @brief Creates a loader that finishes up to \p uploads_per_frame assets in each frame of the render thread.
+    AssetLoader(job::JobSystem& jobs, std::size_t uploads_per_frame);
+
+    /// @brief Waits for the decode jobs that are still running. Assets that haven't been uploaded yet fail with std::future_errc::broken_promise.
+    ~AssetLoader();
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Loads the image at \p img_path into a texture. Can be called from any thread.
+    auto load_texture(std::string img_path) -> AssetHandle<Texture>;
+
+    /// @brief Loads and links the shaders at \p vertex_shader_path and \p fragment_shader_path. Can be called from any thread.
+    auto load_shader(std::string vertex_shader_path, std::string fragment_shader_path) -> AssetHandle<Shader>;
+
+    /// @brief Loads the glTF model at \p model_path, see GLTFModel. Can be called from any thread.
+    auto load_model(std::string model_path, geometry::Transform transform, bool invert, GLTFFileFormat format) -> AssetHandle<GLTFModel>;
+
+    /// @brief Does the GPU uploads of up to the configured number of decoded assets, in the order they finished decoding.
+    ///
+    /// Must be called on the render thread while a context of \p renderer is current.
+    void finalise(Renderer& renderer);
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Returns the number of decoded assets that wait for their GPU upload.
+    [[nodiscard]] auto pending_uploads() const -> std::size_t;
+
+    /// @}
+
+  private:
+    /// @brief Decodes an asset with \p decode on a worker, and then creates it with \p create on the render thread.
+    template <typename T, typename Decode, typename Create>
+    auto load(Decode decode, Create create) -> AssetHandle<T>;
+
+    /// @{
+    /// Private state.
+    job::JobSystem& _jobs;
+    std::size_t _uploads_per_frame;
+    job::JobSystem::Counter _decoding;
+    mutable std::mutex _uploads_mutex;
+    std::deque<std::function<void(Renderer&)>> _uploads;
+    /// @}
+  };
+
+}
@@ -7,6 +7,7 @@ namespace engine::graphics::component {
   /// @todo replace matrix with transform?
   struct GlobalTransform {
     geometry::Matrix<4> matrix;
+    geometry::Matrix<4> previous; //< the matrix of the previous update, which the render thread blends with matrix between updates
   };
 
 }
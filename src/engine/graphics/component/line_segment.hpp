@@ -12,7 +12,9 @@ namespace engine::graphics::component {
   };
 
   struct LineSegments {
-    std::vector<LineSegment> line_segments;
+    std::vector<LineSegment> line_segments; //< sorted by width
+
+    unsigned int mesh = 0; //< the handle of the uploaded lines, assigned by system::RenderProxyBuilder
   };
 
 }
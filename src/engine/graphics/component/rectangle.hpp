@@ -7,10 +7,8 @@ namespace engine::graphics::component {
 
   struct Rectangle {
     geometry::Rectangle geometry;
-    Color color      = Color(1.0F, 1.0F, 1.0F);
-    unsigned int vao = 0;
-    unsigned int vbo = 0;
-    unsigned int ibo = 0;
+    Color color       = Color(1.0F, 1.0F, 1.0F);
+    unsigned int mesh = 0; //< the handle of the uploaded mesh, assigned by system::RenderProxyBuilder
   };
 
 }
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "../../geometry/line_segment.hpp"
+#include "../../geometry/matrix.hpp"
+#include "../color.hpp"
+
+#include <array>
+#include <vector>
+
+namespace engine::graphics::component {
+
+  /// @brief MeshProxy is a packed copy of everything needed to draw one mesh.
+  struct MeshProxy {
+    geometry::Matrix<4> model;
+    geometry::Matrix<4> previous_model; //< the model matrix of the previous update, see GlobalTransform
+    Color color;
+    unsigned int mesh = 0; //< the handle of the mesh, see MeshUpload
+
+    /// @brief Returns the model matrix blended from previous_model towards model by \p alpha, see Interpolation.
+    ///
+    /// The matrices are blended element-wise, which slightly shrinks rotating meshes, but that is negligible for the small rotations between two updates.
+    [[nodiscard]] auto blended_model(float alpha) const -> geometry::Matrix<4> {
+      return alpha < 1.0F ? previous_model * (1.0F - alpha) + model * alpha : model;
+    }
+  };
+
+  /// @brief LineBatch is a range of line segments that share the same width.
+  struct LineBatch {
+    float width;
+    int first; //< the index of the first vertex
+    int count; //< the number of vertices, two per line segment
+  };
+
+  /// @brief LineProxy is a packed copy of everything needed to draw one set of line segments.
+  struct LineProxy {
+    unsigned int mesh = 0; //< the handle of the lines, see LineUpload
+    std::vector<LineBatch> batches;
+  };
+
+  /// @brief RenderProxies stores the meshes of a prepared scene in contiguous arrays, one per mesh type.
+  ///
+  /// Renderers iterate these arrays instead of joining the component pools, which are ordered differently and thus scattered in memory.
+  /// They are rebuilt by system::RenderProxyBuilder on every prepare and stored in the context of the ECS.
+  /// They don't refer to the ECS, so they can be copied into a RenderSnapshot and drawn on the render thread.
+  struct RenderProxies {
+    std::vector<MeshProxy> cuboids;
+    std::vector<MeshProxy> rectangles;
+    std::vector<LineProxy> lines;
+  };
+
+  /// @brief MeshUpload holds the triangles of a mesh that the render thread has to upload under the handle \p mesh.
+  struct MeshUpload {
+    unsigned int mesh = 0;
+    std::vector<geometry::Vector<3>> vertices;
+    std::vector<unsigned int> indices;
+  };
+
+  /// @brief LineUpload holds the line segments that the render thread has to upload under the handle \p mesh.
+  struct LineUpload {
+    unsigned int mesh = 0;
+    std::vector<geometry::LineSegment<3>> positions;
+    std::vector<std::array<float, 3>> colors; //< one per vertex
+  };
+
+  /// @brief MeshUpdates collects the meshes that were created, changed, or destroyed since they were last handed to the render thread.
+  ///
+  /// It is stored in the context of the ECS, next to RenderProxies.
+  struct MeshUpdates {
+    std::vector<MeshUpload> meshes;
+    std::vector<LineUpload> lines;
+    std::vector<unsigned int> released; //< handles of meshes and lines whose components were destroyed
+  };
+
+}
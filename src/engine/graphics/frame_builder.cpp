@@ -0,0 +1,40 @@
+#include "frame_builder.hpp"
+
+#include "system/global_transform_updater.hpp"
+#include "system/render_proxy_builder.hpp"
+
+using namespace engine;
+using namespace engine::graphics;
+
+namespace {
+
+  template <typename T>
+  void move_append(std::vector<T>& from, std::vector<T>& to) {
+    to.insert(to.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(from.end()));
+    from.clear();
+  }
+
+}
+
+FrameBuilder::FrameBuilder(job::JobSystem& jobs)
+        : _prepare_systems(jobs) {
+  _prepare_systems.add("GlobalTransformUpdater", std::make_unique<system::GlobalTransformUpdater>(jobs));
+  _prepare_systems.add("RenderProxyBuilder", std::make_unique<system::RenderProxyBuilder>());
+}
+
+void FrameBuilder::prepare(architecture::ECS& ecs) {
+  _prepare_systems.run(ecs);
+}
+
+void FrameBuilder::capture(architecture::ECS& ecs, RenderSnapshot& snapshot) {
+  const auto* proxies = ecs.try_ctx<component::RenderProxies>();
+  if (proxies == nullptr)
+    return;
+
+  snapshot.scenes.push_back(*proxies);
+
+  auto& updates = ecs.ctx<component::MeshUpdates>();
+  move_append(updates.meshes, snapshot.meshes);
+  move_append(updates.lines, snapshot.lines);
+  move_append(updates.released, snapshot.released);
+}
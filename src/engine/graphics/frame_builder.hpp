@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../architecture/ecs.hpp"
+#include "../architecture/system_scheduler.hpp"
+#include "../job/job_system.hpp"
+#include "render_snapshot.hpp"
+
+#include <vector>
+
+namespace engine::graphics {
+
+  /// @brief FrameBuilder prepares scenes for rendering on the simulation thread, and copies them into render snapshots.
+  ///
+  /// prepare() does the view-independent work, such as computing world transforms and packing meshes into render proxies, and only needs to run once after each update of a scene.
+  /// capture() then copies the prepared scene into a RenderSnapshot, which the render thread draws without touching the ECS.
+  class FrameBuilder {
+  public:
+    FrameBuilder(job::JobSystem& jobs);
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Computes the view-independent render state of the scene stored in \p ecs.
+    void prepare(architecture::ECS& ecs);
+
+    /// @brief Adds the scene stored in \p ecs, as of its last prepare(), to \p snapshot.
+    ///
+    /// The mesh changes of the scene are moved into \p snapshot, so every snapshot only holds the changes since the previous one.
+    void capture(architecture::ECS& ecs, RenderSnapshot& snapshot);
+
+    /// @}
+
+  private:
+    architecture::SystemScheduler _prepare_systems;
+  };
+
+}
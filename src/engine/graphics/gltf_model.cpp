@@ -23,23 +23,37 @@ GLTFModel::GLTFModel(engine::graphics::Renderer& renderer,
                      geometry::Transform transform,
                      bool invert,
                      GLTFFileFormat format)
+        : GLTFModel(renderer, parse(model_path, format), std::move(transform), invert) {}
+
+GLTFModel::GLTFModel(engine::graphics::Renderer& renderer,
+                     tinygltf::Model model,
+                     geometry::Transform transform,
+                     bool invert)
         : _renderer(renderer),
           _transform(std::move(transform)),
           _shader(Shader("gltf.vert", "gltf.frag")),
-          _invert(invert) {
+          _invert(invert),
+          _model(std::move(model)) {
 
+  _vao = _renderer.get().current_context().gen_vao();
+
+  bind_model();
+}
+
+auto GLTFModel::parse(const std::string& model_path, GLTFFileFormat format) -> tinygltf::Model {
   std::string res_path  = boost::dll::program_location().parent_path().string() + "/../res/models/";
   std::string full_path = res_path + model_path;
 
   tinygltf::TinyGLTF loader;
+  tinygltf::Model model;
 
   std::string err;
   std::string warn;
   bool ok = false;
   if (format == GLTFFileFormat::ASCII)
-    ok = loader.LoadASCIIFromFile(&_model, &err, &warn, full_path);
+    ok = loader.LoadASCIIFromFile(&model, &err, &warn, full_path);
   else
-    ok = loader.LoadBinaryFromFile(&_model, &err, &warn, full_path);
+    ok = loader.LoadBinaryFromFile(&model, &err, &warn, full_path);
 
   if (!warn.empty())
     LOG_WARNING(warn);
@@ -48,9 +62,7 @@ GLTFModel::GLTFModel(engine::graphics::Renderer& renderer,
   if (!ok)
     LOG_ERROR("Failed to load .glTF model: " + full_path);
 
-  _vao = _renderer.get().current_context().gen_vao();
-
-  bind_model();
+  return model;
 }
 
 void GLTFModel::bind_model() {
@@ -26,6 +26,15 @@ namespace engine::graphics {
               bool invert           = true,
               GLTFFileFormat format = GLTFFileFormat::ASCII);
 
+    /// @brief Uploads \p model, which was parsed beforehand, e.g. on a worker thread, see parse().
+    GLTFModel(engine::graphics::Renderer& renderer,
+              tinygltf::Model model,
+              geometry::Transform transform,
+              bool invert = true);
+
+    /// @brief Reads and parses the model at \p model_path without touching the graphics API.
+    static auto parse(const std::string& model_path, GLTFFileFormat format) -> tinygltf::Model;
+
     void render(const geometry::Matrix<4>& projection_view);
 
   private:
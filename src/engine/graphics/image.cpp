@@ -16,7 +16,7 @@ Image::Image(const std::string& img_path) {
 
   std::string res_path  = boost::dll::program_location().parent_path().string() + "/res/img/";
   std::string full_path = res_path + img_path;
-  _data                 = std::make_unique<unsigned char>(*stbi_load(full_path.c_str(), &_width, &_height, &_components, STBI_rgb_alpha));
+  _data                 = {stbi_load(full_path.c_str(), &_width, &_height, &_components, STBI_rgb_alpha), stbi_image_free};
 
   if (_data == nullptr)
     LOG_ERROR("Failed to load image: " + full_path);
@@ -8,6 +8,7 @@
 
 namespace engine::graphics {
 
+  /// @brief Image holds the decoded RGBA pixels of an image file. Decoding doesn't touch the graphics API, so it can run on any thread.
   class Image {
   public:
     Image(const std::string& img_path);
@@ -17,7 +18,7 @@ namespace engine::graphics {
     [[nodiscard]] auto height() const -> unsigned int;
 
   private:
-    std::unique_ptr<unsigned char> _data;
+    std::unique_ptr<unsigned char, void (*)(void*)> _data = {nullptr, stbi_image_free};
     int _width      = 0;
     int _height     = 0;
     int _components = 0;
@@ -0,0 +1,73 @@
+#include "mesh_cache.hpp"
+
+#include <array>
+
+using namespace engine::graphics;
+
+void MeshCache::upload(api::IContext& ctx, const component::MeshUpload& upload) {
+  auto& mesh = create(ctx, upload.mesh);
+  mesh.count = static_cast<GLsizei>(upload.indices.size());
+
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(geometry::Vector<3>) * upload.vertices.size(), upload.vertices.data(), GL_STATIC_DRAW);
+
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.ibo);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * upload.indices.size(), upload.indices.data(), GL_STATIC_DRAW);
+}
+
+void MeshCache::upload(api::IContext& ctx, const component::LineUpload& upload) {
+  bool is_new = find(upload.mesh) == nullptr;
+  auto& mesh  = create(ctx, upload.mesh);
+  mesh.count  = static_cast<GLsizei>(upload.colors.size());
+
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(geometry::LineSegment<3>) * upload.positions.size(), upload.positions.data(), GL_DYNAMIC_DRAW);
+
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.ibo);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(std::array<float, 3>) * upload.colors.size(), upload.colors.data(), GL_DYNAMIC_DRAW);
+
+  // NOTE: Creating the mesh also created the VAO of this context, so it is set up here. Other contexts set up theirs when they first draw the mesh.
+  if (is_new) {
+    glBindVertexArray(ctx.vao(mesh.vao));
+    set_up_line_attributes(mesh);
+    glBindVertexArray(0);
+  }
+}
+
+auto MeshCache::release(unsigned int mesh) -> unsigned int {
+  auto it = _meshes.find(mesh);
+  if (it == _meshes.end())
+    return 0;
+
+  std::array<GLuint, 2> buffers = {it->second.vbo, it->second.ibo};
+  glDeleteBuffers(buffers.size(), buffers.data());
+
+  auto vao = it->second.vao;
+  _meshes.erase(it);
+  return vao;
+}
+
+auto MeshCache::find(unsigned int mesh) const -> const Mesh* {
+  auto it = _meshes.find(mesh);
+  return it == _meshes.end() ? nullptr : &it->second;
+}
+
+void MeshCache::set_up_line_attributes(const Mesh& mesh) {
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+  glEnableVertexAttribArray(0);
+
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.ibo);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+  glEnableVertexAttribArray(1);
+}
+
+auto MeshCache::create(api::IContext& ctx, unsigned int mesh) -> Mesh& {
+  auto& created = _meshes[mesh];
+  if (created.vao == 0) {
+    created.vao = ctx.gen_vao();
+    glGenBuffers(1, &created.vbo);
+    glGenBuffers(1, &created.ibo);
+  }
+  return created;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "api/context.hpp"
+#include "component/render_proxies.hpp"
+
+#include <glad/glad.h>
+
+#include <unordered_map>
+
+namespace engine::graphics {
+
+  /// @brief MeshCache owns the GPU buffers of all uploaded meshes on the render thread, by mesh handle.
+  ///
+  /// Buffers are shared between contexts, but every context has its own VAOs, so users must bind the buffers to the VAO of their context when drawing.
+  class MeshCache {
+  public:
+    struct Mesh {
+      unsigned int vao = 0; //< the VAO ID, see api::IContext::vao()
+      GLuint vbo       = 0; //< the vertex positions
+      GLuint ibo       = 0; //< the triangle indices, or the vertex colors of lines
+      GLsizei count    = 0; //< the number of indices, or of vertices for lines
+    };
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Creates or overwrites the buffers of the triangle mesh in \p upload.
+    void upload(api::IContext& ctx, const component::MeshUpload& upload);
+
+    /// @brief Creates or overwrites the buffers of the line segments in \p upload.
+    void upload(api::IContext& ctx, const component::LineUpload& upload);
+
+    /// @brief Deletes the buffers of the mesh with handle \p mesh, and returns its VAO ID so that every context can delete its VAO, or 0.
+    auto release(unsigned int mesh) -> unsigned int;
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Finds the mesh with handle \p mesh, or returns null if it hasn't been uploaded.
+    [[nodiscard]] auto find(unsigned int mesh) const -> const Mesh*;
+
+    /// @}
+
+    /// @brief Points the vertex attributes of the bound VAO to the buffers of the line mesh \p mesh.
+    ///
+    /// The buffers of a mesh keep their names when it is uploaded again, so this is only needed once per VAO.
+    static void set_up_line_attributes(const Mesh& mesh);
+
+  private:
+    std::unordered_map<unsigned int, Mesh> _meshes;
+
+    auto create(api::IContext& ctx, unsigned int mesh) -> Mesh&;
+  };
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "component/render_proxies.hpp"
+
+#include "../geometry/matrix.hpp"
+
+#include <chrono>
+#include <vector>
+
+namespace engine::graphics {
+
+  /// @brief Interpolation tells the render thread how to blend the transforms of a snapshot between the update before it and its own update.
+  ///
+  /// Drawing the blend instead of the latest update keeps motion smooth when the render rate exceeds the update rate, at the cost of one update of latency.
+  struct Interpolation {
+    std::chrono::steady_clock::time_point captured_at;
+    float alpha                              = 1.0F;                             //< how far real time had advanced towards the next update at captured_at, as a fraction of an update
+    std::chrono::nanoseconds update_interval = std::chrono::nanoseconds::zero(); //< the real time between two updates, zero to only draw the latest update
+  };
+
+  /// @brief RenderSnapshot is an immutable copy of everything the render thread needs to draw one frame.
+  ///
+  /// It is built by FrameBuilder on the simulation thread after each update, and never refers to the ECS of a scene.
+  struct RenderSnapshot {
+    bool has_camera = false;
+    geometry::Matrix<4> view_projection;
+    geometry::Matrix<4> previous_view_projection; //< the view_projection of the update before, or the same if the camera just changed
+    std::vector<component::RenderProxies> scenes; //< one per enabled scene
+    Interpolation interpolation;
+
+    /// @brief Returns the view projection blended from previous_view_projection towards view_projection by \p alpha, like component::MeshProxy::blended_model().
+    [[nodiscard]] auto blended_view_projection(float alpha) const -> geometry::Matrix<4> {
+      return alpha < 1.0F ? previous_view_projection * (1.0F - alpha) + view_projection * alpha : view_projection;
+    }
+
+    /// @{
+    /// Mesh changes since the previous snapshot, which must be applied even if the snapshot itself is never drawn.
+    std::vector<component::MeshUpload> meshes;
+    std::vector<component::LineUpload> lines;
+    std::vector<unsigned int> released;
+    /// @}
+  };
+
+}
@@ -0,0 +1,161 @@
+#include "render_thread.hpp"
+
+#include <algorithm>
+
+using namespace engine::graphics;
+
+namespace {
+
+  /// @brief Returns how far the transforms of a snapshot with \p interpolation are blended towards its own update at \p now.
+  auto blend_factor(const Interpolation& interpolation, std::chrono::steady_clock::time_point now) -> float {
+    if (interpolation.update_interval <= std::chrono::nanoseconds::zero())
+      return 1.0F;
+
+    auto since_capture = std::chrono::duration<float>(now - interpolation.captured_at) / std::chrono::duration<float>(interpolation.update_interval);
+    return std::clamp(interpolation.alpha + since_capture, 0.0F, 1.0F);
+  }
+
+  template <typename T>
+  void prepend(std::vector<T>& older, std::vector<T>& newer) {
+    older.insert(older.end(), std::make_move_iterator(newer.begin()), std::make_move_iterator(newer.end()));
+    newer = std::move(older);
+  }
+
+}
+
+RenderThread::RenderThread(os::WindowManager& wm, job::JobSystem& jobs, AssetLoader& assets, std::chrono::nanoseconds frame_time)
+        : _wm(wm),
+          _jobs(jobs),
+          _assets(assets),
+          _frame_time(frame_time) {
+
+  // NOTE: A context can only be current on one thread at a time.
+  _wm.release_render_target();
+
+  std::promise<void> created;
+  auto future = created.get_future();
+  _thread     = std::thread(&RenderThread::run, this, std::ref(created));
+
+  // NOTE: The render thread returns right after a failed setup, and must be joined before the error leaves the constructor.
+  try {
+    future.get();
+  } catch (...) {
+    _thread.join();
+    throw;
+  }
+}
+
+RenderThread::~RenderThread() {
+  _stopping = true;
+  _thread.join();
+}
+
+void RenderThread::publish(RenderSnapshot snapshot) {
+  const std::lock_guard<std::mutex> lock(_snapshot_mutex);
+  if (_error)
+    std::rethrow_exception(_error);
+
+  // Mesh changes must be applied in order, so those of a skipped snapshot go first.
+  if (_is_fresh) {
+    prepend(_latest.meshes, snapshot.meshes);
+    prepend(_latest.lines, snapshot.lines);
+    prepend(_latest.released, snapshot.released);
+  }
+
+  _latest   = std::move(snapshot);
+  _is_fresh = true;
+}
+
+auto RenderThread::lock_frame() -> std::unique_lock<std::mutex> {
+  return std::unique_lock<std::mutex>(_frame_mutex);
+}
+
+void RenderThread::run(std::promise<void>& created) {
+  // NOTE: The renderer owns GL objects, so it must be destroyed on this thread however the thread ends.
+  struct Guard {
+    RenderThread& render_thread;
+    ~Guard() {
+      render_thread.destroy_renderer();
+    }
+  } guard{*this};
+
+  try {
+    {
+      const std::lock_guard<std::mutex> lock(_frame_mutex);
+      _jobs.set_main_thread();
+      _renderer = std::make_unique<Renderer>(_wm);
+      _wm.release_render_target();
+    }
+    created.set_value();
+  } catch (...) {
+    created.set_exception(std::current_exception());
+    return;
+  }
+
+  RenderSnapshot current;
+  float alpha     = 1.0F;
+  auto next_frame = std::chrono::steady_clock::now();
+  try {
+    while (!_stopping) {
+      std::this_thread::sleep_until(next_frame);
+      next_frame = std::max(next_frame + _frame_time, std::chrono::steady_clock::now());
+
+      bool is_fresh = false;
+      {
+        const std::lock_guard<std::mutex> lock(_snapshot_mutex);
+        if (_is_fresh) {
+          // Mesh changes that are still pending, since there was no window to apply them to, go first.
+          prepend(current.meshes, _latest.meshes);
+          prepend(current.lines, _latest.lines);
+          prepend(current.released, _latest.released);
+          std::swap(current, _latest);
+          _is_fresh = false;
+          is_fresh  = true;
+        }
+      }
+
+      // NOTE: The context is released after every frame, since windows may only be destroyed while no thread has their context current.
+      // Without a window there is no context to apply the mesh changes with, so they stay pending until one is created.
+      const std::lock_guard<std::mutex> lock(_frame_mutex);
+      if (_wm.window_count() == 0) {
+        _jobs.run_main_thread_jobs();
+        continue;
+      }
+
+      // Mesh changes are applied before anything else uses the meshes, and only once, however often the snapshot is drawn.
+      _renderer->set_current_context(0);
+      _renderer->apply_mesh_changes(current);
+      current.meshes.clear();
+      current.lines.clear();
+      current.released.clear();
+
+      // Graphics jobs can use any context, since all contexts share their objects.
+      _jobs.run_main_thread_jobs();
+      _assets.finalise(*_renderer);
+
+      // A snapshot is drawn again until its blend reaches its own update.
+      if (is_fresh || alpha < 1.0F) {
+        alpha = blend_factor(current.interpolation, std::chrono::steady_clock::now());
+        _renderer->render(current, alpha);
+      }
+      _wm.release_render_target();
+    }
+  } catch (...) {
+    const std::lock_guard<std::mutex> lock(_snapshot_mutex);
+    _error = std::current_exception();
+  }
+}
+
+void RenderThread::destroy_renderer() noexcept {
+  try {
+    const std::lock_guard<std::mutex> lock(_frame_mutex);
+    if (_renderer && _wm.window_count() > 0)
+      _renderer->set_current_context(0);
+    _renderer = nullptr;
+    _wm.release_render_target();
+  } catch (...) {
+    const std::lock_guard<std::mutex> lock(_snapshot_mutex);
+    if (!_error)
+      _error = std::current_exception();
+  }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "../job/job_system.hpp"
+#include "../os/window_manager.hpp"
+#include "asset_loader.hpp"
+#include "render_snapshot.hpp"
+#include "renderer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace engine::graphics {
+
+  /// @brief RenderThread owns the graphics contexts and draws the latest published RenderSnapshot at a fixed frame rate.
+  ///
+  /// Snapshots are triple buffered: the simulation fills one, the render thread draws another, and the third holds the latest published one.
+  /// Neither thread thus ever waits for the other to finish a frame, and drawing overlaps with the next update.
+  /// Between updates, the latest snapshot is drawn again with its transforms blended from the previous update, see Interpolation.
+  /// The render thread also becomes the main thread of the job system, so that graphics jobs run on it, and it finishes the assets of the AssetLoader.
+  // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+  class RenderThread {
+  public:
+    /// @brief Takes over the graphics contexts of \p wm from the calling thread, and returns once the renderer is created.
+    RenderThread(os::WindowManager& wm, job::JobSystem& jobs, AssetLoader& assets, std::chrono::nanoseconds frame_time);
+
+    ~RenderThread();
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Makes \p snapshot the latest snapshot, which the render thread draws in its next frame.
+    ///
+    /// Mesh changes of a previous snapshot that was never drawn are carried over, so no upload or release is lost.
+    /// Rethrows errors that stopped the render thread.
+    void publish(RenderSnapshot snapshot);
+
+    /// @brief Keeps the render thread from drawing while the lock is held, e.g. while windows are destroyed.
+    auto lock_frame() -> std::unique_lock<std::mutex>;
+
+    /// @}
+
+  private:
+    /// @{
+    /// Private state.
+    os::WindowManager& _wm;
+    job::JobSystem& _jobs;
+    AssetLoader& _assets;
+    std::chrono::nanoseconds _frame_time;
+    std::unique_ptr<Renderer> _renderer;
+
+    std::mutex _snapshot_mutex;
+    RenderSnapshot _latest; //< the latest published snapshot
+    bool _is_fresh = false; //< whether _latest has not been drawn yet
+
+    std::mutex _frame_mutex;
+    std::atomic<bool> _stopping = false;
+    std::exception_ptr _error;
+    std::thread _thread;
+    /// @}
+
+    void run(std::promise<void>& created);
+
+    /// @brief Destroys the renderer with a context current, and keeps the first error if that fails.
+    void destroy_renderer() noexcept;
+  };
+
+}
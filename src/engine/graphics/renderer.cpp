@@ -1,17 +1,7 @@
 #include "renderer.hpp"
 
-#include "../geometry/transform.hpp"
-#include "../scene/component/root.hpp"
-#include "component/render_info.hpp"
-#include "system/cuboid_renderer.hpp"
-#include "system/global_transform_updater.hpp"
-#include "system/line_renderer.hpp"
-#include "system/rectangle_renderer.hpp"
-
 #include <glad/glad.h>
 
-#include <stack>
-
 using namespace engine;
 using namespace engine::graphics;
 
@@ -115,32 +105,68 @@ Renderer::Renderer(os::WindowManager& wm)
 
   _wm.set_render_target(0);
 
-  _render_systems.push_back(std::make_unique<system::GlobalTransformUpdater>());
-  _render_systems.push_back(std::make_unique<system::LineRenderer>());
-  _render_systems.push_back(std::make_unique<system::RectangleRenderer>());
-  _render_systems.push_back(std::make_unique<system::CuboidRenderer>());
+  // NOTE: The renderers compile their shaders, so they are created once a context is current.
+  _line_renderer      = std::make_unique<system::LineRenderer>();
+  _rectangle_renderer = std::make_unique<system::RectangleRenderer>();
+  _cuboid_renderer    = std::make_unique<system::CuboidRenderer>();
 }
 
-void Renderer::render(architecture::ECS& ecs,
-                      unsigned int window_id,
-                      geometry::Matrix<4> view_projection) {
-  if (!_wm.is_target_available(window_id)) {
-    LOG_WARNING("Can't render to window with ID " + std::to_string(window_id) + " since that target is currently not available.");
-    return;
+void Renderer::apply_mesh_changes(const RenderSnapshot& snapshot) {
+  // NOTE: Buffers are shared between contexts, so uploading them once is enough.
+  _current_context = 0;
+  _wm.set_render_target(_current_context);
+  for (const auto& upload : snapshot.meshes)
+    _meshes.upload(current_context(), upload);
+  for (const auto& upload : snapshot.lines)
+    _meshes.upload(current_context(), upload);
+
+  release_meshes(snapshot.released);
+}
+
+void Renderer::render(const RenderSnapshot& snapshot, float alpha) {
+  if (snapshot.has_camera) {
+    auto view_projection = snapshot.blended_view_projection(alpha);
+    for (unsigned int i = 0; i < _wm.window_count(); i++) {
+      _wm.set_render_target(i);
+      _current_context = i;
+
+      _wm.clear_target();
+
+      for (const auto& scene : snapshot.scenes) {
+        _line_renderer->draw(scene.lines, view_projection, current_context(), _meshes);
+        _rectangle_renderer->draw(scene.rectangles, view_projection, alpha, current_context(), _meshes);
+        _cuboid_renderer->draw(scene.cuboids, view_projection, alpha, current_context(), _meshes);
+      }
+
+      _wm.refresh_target();
+    }
   }
-  _wm.set_render_target(window_id);
-  _current_context = window_id;
+}
+
+void Renderer::release_meshes(const std::vector<unsigned int>& released) {
+  if (released.empty())
+    return;
 
-  _wm.clear_target();
+  std::vector<unsigned int> vaos;
+  for (auto mesh : released)
+    if (auto vao = _meshes.release(mesh); vao != 0)
+      vaos.push_back(vao);
 
-  // Ensure root has updated RenderInfo
-  auto root = ecs.view<scene::component::Root>()[0];
-  ecs.emplace_or_replace<component::RenderInfo>(root, view_projection, current_context());
+  // NOTE: Every context has its own VAOs.
+  for (unsigned int i = 0; i < _render_contexts.size(); i++) {
+    if (!_wm.is_target_available(i))
+      continue;
 
-  for (auto& system : _render_systems)
-    system->update(ecs);
+    _wm.set_render_target(i);
+    for (auto vao : vaos)
+      _render_contexts[i]->delete_vao(vao);
+  }
+  _wm.set_render_target(_current_context);
+}
 
-  _wm.refresh_target();
+void Renderer::set_current_context(unsigned int context_id) {
+  _current_context = context_id;
+  _wm.set_render_target(context_id);
 }
 
 auto Renderer::current_context() -> api::IContext& {
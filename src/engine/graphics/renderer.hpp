@@ -1,35 +1,55 @@
 #pragma once
 
-#include "../architecture/ecs.hpp"
-
 #include "../geometry/matrix.hpp"
 #include "../os/window_manager.hpp"
 #include "api/context.hpp"
+#include "mesh_cache.hpp"
+#include "render_snapshot.hpp"
+#include "system/cuboid_renderer.hpp"
+#include "system/line_renderer.hpp"
+#include "system/rectangle_renderer.hpp"
 
 #include <memory>
 #include <vector>
 
 namespace engine::graphics {
 
-  /// @brief Renderer renders given scenes to one or multiple windows.
+  /// @brief Renderer renders snapshots of the scenes to all windows.
+  ///
+  /// It owns the graphics contexts and all GPU resources, so it must be created, used, and destroyed on the render thread, see RenderThread.
+  /// The scenes themselves are prepared on the simulation thread by FrameBuilder.
   ///
   /// @todo render() should take a list of window targets so it can call renderable.render() once and then copy the pixels/result to all windows.
-  /// @todo render() should maybe have option to not clear/update.
   /// @todo have the generic contexts contain references to their windows.
   /// @todo rename to RenderSystem
   class Renderer {
   public:
     Renderer(os::WindowManager& wm);
 
-    void render(architecture::ECS& ecs, unsigned int window_id, geometry::Matrix<4> view_projection);
+    /// @brief Uploads and releases the meshes that changed in \p snapshot.
+    ///
+    /// It needs a current context, so it must only be called while a window exists.
+    void apply_mesh_changes(const RenderSnapshot& snapshot);
+
+    /// @brief Draws \p snapshot to every window, with its transforms and its camera blended from the previous update by \p alpha.
+    void render(const RenderSnapshot& snapshot, float alpha);
+
+    /// @brief Makes the context of window \p context_id current, e.g. to create resources outside of render().
+    void set_current_context(unsigned int context_id);
 
     auto current_context() -> api::IContext&;
     [[nodiscard]] auto context_count() const -> unsigned int;
 
   private:
+    /// @brief Deletes the GPU resources of the meshes with handles \p released.
+    void release_meshes(const std::vector<unsigned int>& released);
+
     os::WindowManager& _wm;
     unsigned int _current_context = 0;
     std::vector<std::unique_ptr<api::IContext>> _render_contexts;
-    std::vector<std::unique_ptr<architecture::IEntitySystem>> _render_systems;
+    MeshCache _meshes;
+    std::unique_ptr<system::LineRenderer> _line_renderer;
+    std::unique_ptr<system::RectangleRenderer> _rectangle_renderer;
+    std::unique_ptr<system::CuboidRenderer> _cuboid_renderer;
   };
 };
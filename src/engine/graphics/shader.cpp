@@ -14,10 +14,23 @@ Shader::Shader(std::string vertex_shader_path, std::string fragment_shader_path)
   compile();
 }
 
+Shader::Shader(std::string vertex_shader_path, std::string fragment_shader_path, const Sources& sources)
+        : _vertex_shader_path(std::move(vertex_shader_path)),
+          _fragment_shader_path(std::move(fragment_shader_path)) {
+  link(compile_shader(_vertex_shader_path, sources.vertex, GL_VERTEX_SHADER),
+       compile_shader(_fragment_shader_path, sources.fragment, GL_FRAGMENT_SHADER));
+}
+
+auto Shader::read_sources(const std::string& vertex_shader_path, const std::string& fragment_shader_path) -> Sources {
+  return {read_source(vertex_shader_path), read_source(fragment_shader_path)};
+}
+
 void Shader::compile() {
-  GLuint vertex_shader   = load_shader_file(_vertex_shader_path, GL_VERTEX_SHADER);
-  GLuint fragment_shader = load_shader_file(_fragment_shader_path, GL_FRAGMENT_SHADER);
+  link(load_shader_file(_vertex_shader_path, GL_VERTEX_SHADER),
+       load_shader_file(_fragment_shader_path, GL_FRAGMENT_SHADER));
+}
 
+void Shader::link(GLuint vertex_shader, GLuint fragment_shader) {
   _program = glCreateProgram();
 
   glAttachShader(_program, vertex_shader);
@@ -68,15 +81,24 @@ auto Shader::load_shader_file(const std::string& shader_path, GLenum shader_type
   if (_cache.count(shader_path) != 0U)
     return _cache[shader_path];
 
-  GLuint shader = glCreateShader(shader_type);
+  return compile_shader(shader_path, read_source(shader_path), shader_type);
+}
 
+auto Shader::read_source(const std::string& shader_path) -> std::string {
   std::string res_path         = boost::dll::program_location().parent_path().string() + "/../res/shaders/";
   std::string full_shader_path = res_path + shader_path;
 
   std::ifstream file(full_shader_path);
-  std::string src((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+auto Shader::compile_shader(const std::string& shader_path, const std::string& source, GLenum shader_type) -> GLuint {
+  if (_cache.count(shader_path) != 0U)
+    return _cache[shader_path];
+
+  GLuint shader = glCreateShader(shader_type);
 
-  const char* raw_shader = src.c_str();
+  const char* raw_shader = source.c_str();
   glShaderSource(shader, 1, &raw_shader, nullptr);
 
   glCompileShader(shader);
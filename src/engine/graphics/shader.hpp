@@ -12,8 +12,20 @@ namespace engine::graphics {
 
   class Shader {
   public:
+    /// @brief The source code of a shader program, which can be read on any thread.
+    struct Sources {
+      std::string vertex;
+      std::string fragment;
+    };
+
     Shader(std::string vertex_shader_path, std::string fragment_shader_path);
 
+    /// @brief Compiles \p sources, which were read from \p vertex_shader_path and \p fragment_shader_path beforehand, e.g. on a worker thread.
+    Shader(std::string vertex_shader_path, std::string fragment_shader_path, const Sources& sources);
+
+    /// @brief Reads the source code of the shaders at \p vertex_shader_path and \p fragment_shader_path without touching the graphics API.
+    static auto read_sources(const std::string& vertex_shader_path, const std::string& fragment_shader_path) -> Sources;
+
     // Mutators
     void use();
     void set_uniform_rgb(const GLchar* uniform, const Color& color) const;
@@ -30,8 +42,11 @@ namespace engine::graphics {
 
     // Accessors
     static auto load_shader_file(const std::string& shader_path, GLenum shader_type) -> GLuint;
+    static auto read_source(const std::string& shader_path) -> std::string;
+    static auto compile_shader(const std::string& shader_path, const std::string& source, GLenum shader_type) -> GLuint;
 
     // Mutators
     void compile();
+    void link(GLuint vertex_shader, GLuint fragment_shader);
   };
 }
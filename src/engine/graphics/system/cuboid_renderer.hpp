@@ -1,24 +1,30 @@
 #pragma once
 
-#include "../../architecture/ecs.hpp"
-
 #include "../api/context.hpp"
-#include "../component/cuboid.hpp"
+#include "../component/render_proxies.hpp"
+#include "../mesh_cache.hpp"
 #include "../shader.hpp"
 
+#include "../../geometry/matrix.hpp"
+
 namespace engine::graphics::system {
 
-  class CuboidRenderer : public architecture::IEntitySystem {
+  class CuboidRenderer {
   public:
     CuboidRenderer();
 
-    void update(architecture::ECS& ecs) override;
+    /// @brief Draws the cuboids in \p proxies to the current render target, using the buffers in \p meshes.
+    ///
+    /// Their transforms are blended from the previous update by \p alpha.
+    void draw(const std::vector<component::MeshProxy>& proxies,
+              const geometry::Matrix<4>& view_projection,
+              float alpha,
+              api::IContext& ctx,
+              const MeshCache& meshes);
 
   private:
     graphics::Shader _shader;
     bool _draw_corners = false;
-
-    static void compile_cuboid(api::IContext& ctx, component::Cuboid& cuboid);
   };
 
 }
@@ -3,51 +3,138 @@
 #include "../component/global_transform.hpp"
 
 #include "../../scene/component/node.hpp"
-#include "../../scene/component/root.hpp"
+#include "../../scene/component/static.hpp"
+#include "../../scene/hierarchy.hpp"
 
-#include <stack>
+#include "../../architecture/component_changes.hpp"
+#include "../../geometry/transform_batch.hpp"
 
 using namespace engine;
 using namespace engine::graphics::system;
 
+namespace {
+
+  /// Stored in the context of the ECS to detect changes to the hierarchy since the last update, and to reuse buffers between updates.
+  struct ProcessedOrder {
+    unsigned int version = 0;
+    geometry::TransformBatch locals;           //< the local transforms of the dynamic nodes, in hierarchy order
+    std::vector<geometry::Matrix<4>> matrices; //< the local matrices of the dynamic nodes, in hierarchy order
+  };
+
+}
+
+GlobalTransformUpdater::GlobalTransformUpdater(job::JobSystem& jobs)
+        : _jobs(jobs) {}
+
 void GlobalTransformUpdater::update(architecture::ECS& ecs) {
-  architecture::EntityID root = ecs.view<scene::component::Root>()[0];
+  const auto& order = scene::hierarchy_order(ecs);
 
-  // Ensure all entities with Transform also have GlobalTransform.
-  for (auto e : ecs.view<geometry::Transform>(entt::exclude<component::GlobalTransform>))
-    ecs.emplace<component::GlobalTransform>(e);
+  auto* processed = ecs.try_ctx<ProcessedOrder>();
+  if (processed == nullptr)
+    processed = &ecs.set<ProcessedOrder>();
 
-  // Keep track of when to pop matrices.
-  std::stack<unsigned int> subtree_done_at;
-  subtree_done_at.push(0);
+  // NOTE: New nodes always change the order, so unchanged hierarchies skip all per-node bookkeeping.
+  bool hierarchy_changed = processed->version != order.version;
 
-  // DFS of scene hierarchy matrices.
-  std::stack<geometry::Matrix<4>> matrices;
-  matrices.push(geometry::Matrix<4>());
+  // Ensure all nodes have a GlobalTransform, also those without a Transform, since their children inherit it.
+  auto& new_nodes = architecture::changes<GlobalTransformUpdater, scene::component::Node>(ecs);
+  for (auto e : new_nodes.added())
+    if (!ecs.has<component::GlobalTransform>(e))
+      ecs.emplace<component::GlobalTransform>(e);
+  std::vector<architecture::EntityID> added = new_nodes.added();
+  new_nodes.clear();
 
-  // DFS.
-  std::stack<architecture::EntityID> dfs;
-  dfs.push(architecture::NullEntityID);
-  dfs.push(root);
+  // NOTE: The views are created up front since workers may only read from the ECS, never create pools in it.
+  auto nodes      = ecs.view<scene::component::Node>();
+  auto transforms = ecs.view<geometry::Transform>();
+  auto globals    = ecs.view<component::GlobalTransform>();
 
-  while (dfs.top() != architecture::NullEntityID) {
-    auto cur = dfs.top();
-    dfs.pop();
+  // First compute the local matrices of all dynamic nodes in one batched pass, since they don't depend on each other.
+  auto dynamic_count = order.static_begin;
+  processed->locals.resize(dynamic_count);
+  processed->matrices.resize(dynamic_count);
 
-    // while loop because sometimes we finish multiple subtrees at once.
-    while (dfs.size() == subtree_done_at.top()) {
-      matrices.pop();
-      subtree_done_at.pop();
+  auto compute_locals = [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++) {
+      if (transforms.contains(order.nodes[i]))
+        processed->locals.set(i, transforms.get<geometry::Transform>(order.nodes[i]));
+      else
+        processed->locals.set_identity(i);
     }
+    processed->locals.compute_matrices(begin, end, processed->matrices.data());
+  };
+
+  if (dynamic_count < min_parallel_level_size)
+    compute_locals(0, dynamic_count);
+  else
+    _jobs.parallel_for(dynamic_count, min_chunk_size, compute_locals);
+
+  // Then propagate them down the hierarchy.
+  auto propagate = [&](std::size_t i) {
+    auto e           = order.nodes[i];
+    const auto& node = nodes.get<scene::component::Node>(e);
+
+    auto& global    = globals.get<component::GlobalTransform>(e);
+    global.previous = global.matrix;
+    if (node.parent != architecture::NullEntityID)
+      global.matrix = globals.get<component::GlobalTransform>(node.parent).matrix * processed->matrices[i];
+    else
+      global.matrix = processed->matrices[i];
+  };
 
-    if (auto* c = ecs.try_get<geometry::Transform>(cur); c != nullptr) {
-      matrices.push(matrices.top() * c->matrix());
-      subtree_done_at.push(dfs.size() - 1); // Tree will be one less because we pop the next sibling from dfs.
+  // Each depth level only reads from the levels above it, so the nodes within a level are independent of each other.
+  for (std::size_t level = 0; level < order.levels.size(); level++) {
+    std::size_t level_begin = order.levels[level];
+    std::size_t level_end   = level + 1 < order.levels.size() ? order.levels[level + 1] : order.static_begin;
 
-      ecs.get<component::GlobalTransform>(cur).matrix = matrices.top();
+    if (level_end - level_begin < min_parallel_level_size) {
+      for (std::size_t i = level_begin; i < level_end; i++)
+        propagate(i);
+    } else {
+      _jobs.parallel_for(level_end - level_begin, min_chunk_size, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = level_begin + begin; i < level_begin + end; i++)
+          propagate(i);
+      });
     }
+  }
+
+  // New nodes have no previous update to blend from, so they appear right where they are.
+  for (auto e : added)
+    if (globals.contains(e))
+      globals.get<component::GlobalTransform>(e).previous = globals.get<component::GlobalTransform>(e).matrix;
+
+  // Static nodes can only have become unbaked if the hierarchy has changed.
+  if (!hierarchy_changed)
+    return;
+
+  auto statics = ecs.view<scene::component::Static>();
+  for (std::size_t i = order.static_begin; i < order.nodes.size(); i++) {
+    auto e  = order.nodes[i];
+    auto& s = statics.get<scene::component::Static>(e);
+    if (s.baked)
+      continue;
 
-    for (auto c : ecs.get<scene::component::Node>(cur).children)
-      dfs.push(c);
+    geometry::Matrix<4> parent_matrix;
+    if (auto parent = nodes.get<scene::component::Node>(e).parent; parent != architecture::NullEntityID)
+      parent_matrix = globals.get<component::GlobalTransform>(parent).matrix;
+
+    auto& global = globals.get<component::GlobalTransform>(e);
+    if (transforms.contains(e))
+      global.matrix = parent_matrix * transforms.get<geometry::Transform>(e).matrix();
+    else
+      global.matrix = parent_matrix;
+    global.previous = global.matrix;
+    s.baked         = true;
   }
+
+  processed->version = order.version;
+}
+
+auto GlobalTransformUpdater::access() const -> architecture::SystemAccess {
+  // Sorting the hierarchy writes the nodes and its cached order, and baking static nodes writes their Static component.
+  architecture::SystemAccess access;
+  access.read<geometry::Transform>()
+    .write<component::GlobalTransform, scene::component::Node, scene::component::Static>()
+    .write_context<ProcessedOrder, scene::CachedOrder, architecture::ComponentChanges<GlobalTransformUpdater, scene::component::Node>>();
+  return access;
 }
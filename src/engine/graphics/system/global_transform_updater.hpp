@@ -1,11 +1,30 @@
 #pragma once
 
 #include "../../architecture/ecs.hpp"
+#include "../../job/job_system.hpp"
 
 namespace engine::graphics::system {
 
-  struct GlobalTransformUpdater : public architecture::IEntitySystem {
-    void update(architecture::ECS& _ecs) override;
+  /// @brief GlobalTransformUpdater computes the world matrix of every scene node.
+  ///
+  /// The local matrices of all dynamic nodes are first computed in one batched pass over a geometry::TransformBatch.
+  /// They are then propagated down the hierarchy, where nodes at the same depth only depend on their parents, so each depth level is updated in parallel.
+  /// Static nodes are only computed once, when they are first seen.
+  /// The world matrix of the previous update is kept as well, so that the render thread can blend between the two.
+  class GlobalTransformUpdater : public architecture::IEntitySystem {
+  public:
+    GlobalTransformUpdater(job::JobSystem& jobs);
+
+    void update(architecture::ECS& ecs) override;
+
+    [[nodiscard]] auto access() const -> architecture::SystemAccess override;
+
+  private:
+    /// Levels smaller than this are updated on the calling thread since distributing them costs more than it saves.
+    static constexpr std::size_t min_parallel_level_size = 1024;
+    static constexpr std::size_t min_chunk_size          = 256;
+
+    job::JobSystem& _jobs;
   };
 
 }
@@ -1,7 +1,9 @@
 #pragma once
 
-#include "../../architecture/ecs.hpp"
+#include "../api/context.hpp"
 #include "../component/line_segment.hpp"
+#include "../component/render_proxies.hpp"
+#include "../mesh_cache.hpp"
 #include "../shader.hpp"
 
 #include "../../geometry/matrix.hpp"
@@ -11,7 +13,7 @@
 
 namespace engine::graphics::system {
 
-  class LineRenderer : public architecture::IEntitySystem {
+  class LineRenderer {
   public:
     LineRenderer();
 
@@ -20,7 +22,11 @@ namespace engine::graphics::system {
     void add_line(component::LineSegment&& line);
     void clear();
 
-    void update(architecture::ECS& ecs) override;
+    /// @brief Draws the line segments in \p proxies to the current render target, using the buffers in \p meshes.
+    void draw(const std::vector<component::LineProxy>& proxies,
+              const geometry::Matrix<4>& view_projection,
+              api::IContext& ctx,
+              const MeshCache& meshes);
 
   private:
     graphics::Shader _shader;
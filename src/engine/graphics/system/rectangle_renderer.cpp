@@ -1,70 +1,36 @@
 #include "rectangle_renderer.hpp"
 
-#include "../component/global_transform.hpp"
-#include "../component/render_info.hpp"
-
 using namespace engine::graphics::system;
 
 RectangleRenderer::RectangleRenderer()
         : _shader(Shader("unicolor.vert", "color.frag")) {}
 
-void RectangleRenderer::update(architecture::ECS& ecs) {
-  auto& render_info = ecs.get<component::RenderInfo>(ecs.view<component::RenderInfo>()[0]);
-  auto& ctx         = render_info.context.get();
-
+void RectangleRenderer::draw(const std::vector<component::MeshProxy>& proxies,
+                             const geometry::Matrix<4>& view_projection,
+                             float alpha,
+                             api::IContext& ctx,
+                             const MeshCache& meshes) {
   _shader.use();
 
-  for (auto entity : ecs.view<component::Rectangle>()) {
-    auto& rectangle = ecs.get<component::Rectangle>(entity);
-
-    if (rectangle.vao == 0)
-      compile_rectangle(ctx, rectangle);
+  for (const auto& proxy : proxies) {
+    const auto* mesh = meshes.find(proxy.mesh);
+    if (mesh == nullptr)
+      continue;
 
-    glBindVertexArray(ctx.vao(rectangle.vao));
+    glBindVertexArray(ctx.vao(mesh->vao));
 
-    glBindBuffer(GL_ARRAY_BUFFER, rectangle.vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->vbo);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, 0U, 0, nullptr);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, rectangle.ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->ibo);
 
-    auto mvp = render_info.view_projection * ecs.get<component::GlobalTransform>(entity).matrix;
+    auto mvp = view_projection * proxy.blended_model(alpha);
     _shader.set_uniform_mat4("model_view_projection", mvp);
-    _shader.set_uniform_rgb("color", rectangle.color);
+    _shader.set_uniform_rgb("color", proxy.color);
 
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+    glDrawElements(GL_TRIANGLES, mesh->count, GL_UNSIGNED_INT, nullptr);
   }
 
   glBindVertexArray(0);
 }
-
-void RectangleRenderer::compile_rectangle(api::IContext& ctx, component::Rectangle& rectangle) {
-  rectangle.vao = ctx.gen_vao();
-  glBindVertexArray(ctx.vao(rectangle.vao));
-
-  glGenBuffers(1, &rectangle.vbo);
-  glGenBuffers(1, &rectangle.ibo);
-
-  std::array<geometry::Vector<3>, 4> vertices = {
-    rectangle.geometry.botleft(),
-    rectangle.geometry.botright(),
-    rectangle.geometry.topleft(),
-    rectangle.geometry.topright(),
-  };
-
-  glBindBuffer(GL_ARRAY_BUFFER, rectangle.vbo);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices.data(), GL_STATIC_DRAW);
-
-  const std::array<unsigned int, 6> indices = {
-    0,
-    1,
-    2,
-
-    3,
-    2,
-    1,
-  };
-
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, rectangle.ibo);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices.data(), GL_STATIC_DRAW);
-}
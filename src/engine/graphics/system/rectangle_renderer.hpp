@@ -1,23 +1,29 @@
 #pragma once
 
-#include "../../architecture/ecs.hpp"
-
 #include "../api/context.hpp"
-#include "../component/rectangle.hpp"
+#include "../component/render_proxies.hpp"
+#include "../mesh_cache.hpp"
 #include "../shader.hpp"
 
+#include "../../geometry/matrix.hpp"
+
 namespace engine::graphics::system {
 
-  class RectangleRenderer : public architecture::IEntitySystem {
+  class RectangleRenderer {
   public:
     RectangleRenderer();
 
-    void update(architecture::ECS& ecs) override;
+    /// @brief Draws the rectangles in \p proxies to the current render target, using the buffers in \p meshes.
+    ///
+    /// Their transforms are blended from the previous update by \p alpha.
+    void draw(const std::vector<component::MeshProxy>& proxies,
+              const geometry::Matrix<4>& view_projection,
+              float alpha,
+              api::IContext& ctx,
+              const MeshCache& meshes);
 
   private:
     graphics::Shader _shader;
-
-    static void compile_rectangle(api::IContext& ctx, component::Rectangle& rectangle);
   };
 
 }
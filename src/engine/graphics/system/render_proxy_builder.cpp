@@ -0,0 +1,215 @@
+#include "render_proxy_builder.hpp"
+
+#include "../component/cuboid.hpp"
+#include "../component/global_transform.hpp"
+#include "../component/line_segment.hpp"
+#include "../component/rectangle.hpp"
+#include "../component/render_proxies.hpp"
+
+#include "../../architecture/component_changes.hpp"
+#include "../../scene/component/static.hpp"
+
+#include <atomic>
+
+using namespace engine;
+using namespace engine::graphics::system;
+
+namespace {
+
+  /// Stored in the context of the ECS once destroyed mesh components release their meshes.
+  struct ReleaseHooks {
+    bool connected = false;
+  };
+
+  /// Handles are unique across all scenes since they share the render thread, and they are never reused, so a late release can't hit a newer mesh.
+  std::atomic<unsigned int> next_mesh = 1;
+
+  auto make_upload(unsigned int mesh, const graphics::component::Cuboid& cuboid) -> graphics::component::MeshUpload {
+    auto geometry   = cuboid.geometry;
+    auto back_face  = geometry.back_face();
+    auto front_face = geometry.front_face();
+
+    return {
+      .mesh     = mesh,
+      .vertices = {
+        back_face.botleft(),
+        back_face.botright(),
+        back_face.topleft(),
+        back_face.topright(),
+        front_face.botleft(),
+        front_face.botright(),
+        front_face.topleft(),
+        front_face.topright(),
+      },
+      .indices = {
+        // Left face
+        5, 0, 7,
+        2, 7, 0,
+        // Right face
+        1, 4, 3,
+        6, 3, 4,
+        // Bottom face
+        5, 4, 0,
+        1, 0, 4,
+        // Top face
+        2, 3, 7,
+        6, 7, 3,
+        // Back face
+        0, 1, 2,
+        3, 2, 1,
+        // Front face
+        4, 5, 6,
+        7, 6, 5,
+      },
+    };
+  }
+
+  auto make_upload(unsigned int mesh, const graphics::component::Rectangle& rectangle) -> graphics::component::MeshUpload {
+    return {
+      .mesh     = mesh,
+      .vertices = {
+        rectangle.geometry.botleft(),
+        rectangle.geometry.botright(),
+        rectangle.geometry.topleft(),
+        rectangle.geometry.topright(),
+      },
+      .indices = {
+        0, 1, 2,
+        3, 2, 1,
+      },
+    };
+  }
+
+  auto make_upload(unsigned int mesh, const graphics::component::LineSegments& segments) -> graphics::component::LineUpload {
+    graphics::component::LineUpload upload;
+    upload.mesh = mesh;
+    upload.positions.reserve(segments.line_segments.size());
+    upload.colors.reserve(2 * segments.line_segments.size());
+    for (const auto& line_segment : segments.line_segments) {
+      upload.positions.push_back(line_segment.geometry);
+      for (int i = 0; i < 2; i++)
+        upload.colors.push_back(line_segment.color.rgb());
+    }
+    return upload;
+  }
+
+  /// Gets the context variable of type \p T, which the SystemScheduler may already have created, see RenderProxyBuilder::access().
+  template <typename T>
+  auto context(architecture::ECS& ecs) -> T& {
+    if (auto* existing = ecs.try_ctx<T>(); existing != nullptr)
+      return *existing;
+    return ecs.set<T>();
+  }
+
+  template <typename T>
+  void release_mesh(architecture::ECS& ecs, architecture::EntityID entity) {
+    if (auto mesh = ecs.get<T>(entity).mesh; mesh != 0)
+      ecs.ctx<graphics::component::MeshUpdates>().released.push_back(mesh);
+  }
+
+  /// Assigns handles to the meshes that were added since the last update, and uploads those and the replaced ones.
+  template <typename T>
+  void upload_changed_meshes(architecture::ECS& ecs, graphics::component::MeshUpdates& updates) {
+    auto& changed = architecture::changes<RenderProxyBuilder, T>(ecs);
+
+    // NOTE: Added components always get a new handle, since copies of a component, e.g. from a prefab, must not share its mesh.
+    for (auto entity : changed.added()) {
+      auto& mesh = ecs.get<T>(entity);
+      mesh.mesh  = next_mesh++;
+      updates.meshes.push_back(make_upload(mesh.mesh, mesh));
+    }
+
+    for (auto entity : changed.updated()) {
+      auto& mesh = ecs.get<T>(entity);
+      if (mesh.mesh == 0)
+        mesh.mesh = next_mesh++;
+      updates.meshes.push_back(make_upload(mesh.mesh, mesh));
+    }
+
+    changed.clear();
+  }
+
+  template <typename T>
+  void build_proxies(architecture::ECS& ecs, std::vector<graphics::component::MeshProxy>& proxies) {
+    auto view = ecs.view<T, graphics::component::GlobalTransform>();
+
+    proxies.clear();
+    proxies.reserve(ecs.size<T>());
+    for (auto entity : view) {
+      const auto& mesh   = view.template get<T>(entity);
+      const auto& global = view.template get<graphics::component::GlobalTransform>(entity);
+      proxies.push_back(graphics::component::MeshProxy{
+        .model          = global.matrix,
+        .previous_model = global.previous,
+        .color          = mesh.color,
+        .mesh           = mesh.mesh,
+      });
+    }
+  }
+
+  void build_line_proxies(architecture::ECS& ecs, graphics::component::RenderProxies& proxies, graphics::component::MeshUpdates& updates) {
+    // Added line segments must not share the buffers of the segments they were copied from.
+    auto& changed = architecture::changes<RenderProxyBuilder, graphics::component::LineSegments>(ecs);
+    for (auto entity : changed.added())
+      ecs.get<graphics::component::LineSegments>(entity).mesh = 0;
+    changed.clear();
+
+    proxies.lines.clear();
+    for (auto entity : ecs.view<graphics::component::LineSegments>()) {
+      auto& segments = ecs.get<graphics::component::LineSegments>(entity);
+      if (segments.line_segments.empty())
+        continue;
+
+      // NOTE: Static line segments never change, so they only need to be uploaded once.
+      if (segments.mesh == 0) {
+        segments.mesh = next_mesh++;
+        updates.lines.push_back(make_upload(segments.mesh, segments));
+      } else if (!ecs.has<scene::component::Static>(entity)) {
+        updates.lines.push_back(make_upload(segments.mesh, segments));
+      }
+
+      // The segments are sorted by width, so each width is one contiguous batch.
+      auto& proxy = proxies.lines.emplace_back();
+      proxy.mesh  = segments.mesh;
+      for (std::size_t i = 0; i < segments.line_segments.size(); i++) {
+        float width = segments.line_segments[i].width;
+        if (proxy.batches.empty() || proxy.batches.back().width != width)
+          proxy.batches.push_back({.width = width, .first = static_cast<int>(2 * i), .count = 0});
+        proxy.batches.back().count += 2;
+      }
+    }
+  }
+
+}
+
+void RenderProxyBuilder::update(architecture::ECS& ecs) {
+  auto& proxies = context<component::RenderProxies>(ecs);
+  auto& updates = context<component::MeshUpdates>(ecs);
+
+  if (auto& hooks = context<ReleaseHooks>(ecs); !hooks.connected) {
+    ecs.on_destroy<component::Cuboid>().connect<&release_mesh<component::Cuboid>>();
+    ecs.on_destroy<component::Rectangle>().connect<&release_mesh<component::Rectangle>>();
+    ecs.on_destroy<component::LineSegments>().connect<&release_mesh<component::LineSegments>>();
+    hooks.connected = true;
+  }
+
+  upload_changed_meshes<component::Cuboid>(ecs, updates);
+  upload_changed_meshes<component::Rectangle>(ecs, updates);
+
+  // NOTE: Entities created since the last prepare() have no GlobalTransform yet and are skipped until then.
+  build_proxies<component::Cuboid>(ecs, proxies.cuboids);
+  build_proxies<component::Rectangle>(ecs, proxies.rectangles);
+  build_line_proxies(ecs, proxies, updates);
+}
+
+auto RenderProxyBuilder::access() const -> architecture::SystemAccess {
+  // Mesh handles are assigned to the mesh components.
+  architecture::SystemAccess access;
+  access.read<component::GlobalTransform, scene::component::Static>()
+    .write<component::Cuboid, component::Rectangle, component::LineSegments>()
+    .write_context<ReleaseHooks, component::RenderProxies, component::MeshUpdates>()
+    .write_context<architecture::ComponentChanges<RenderProxyBuilder, component::Cuboid>,
+                   architecture::ComponentChanges<RenderProxyBuilder, component::Rectangle>,
+                   architecture::ComponentChanges<RenderProxyBuilder, component::LineSegments>>();
+  return access;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "../../architecture/ecs.hpp"
+
+namespace engine::graphics::system {
+
+  /// @brief RenderProxyBuilder packs the render state of all meshes into component::RenderProxies.
+  ///
+  /// It runs once per prepare, after the global transforms are up to date, so that the render thread only does sequential reads.
+  /// It also assigns mesh handles to new meshes, and collects the vertex data the render thread has to upload for them in component::MeshUpdates.
+  class RenderProxyBuilder : public architecture::IEntitySystem {
+  public:
+    void update(architecture::ECS& ecs) override;
+
+    [[nodiscard]] auto access() const -> architecture::SystemAccess override;
+  };
+
+}
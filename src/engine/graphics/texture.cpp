@@ -1,12 +1,11 @@
 #include "texture.hpp"
 
 #include "../debug/logger.hpp"
+#include "image.hpp"
 
 #include <boost/dll/runtime_symbol_info.hpp>
 #include <map>
 
-#include "image.hpp"
-
 using namespace engine::graphics;
 
 static std::map<std::string, GLuint> _cache;
@@ -18,7 +17,23 @@ Texture::Texture(const std::string& img_path) {
     return;
   }
 
-  Image image(img_path);
+  upload(Image(img_path));
+  _cache[img_path] = _texture;
+}
+
+Texture::Texture(const std::string& img_path, const Image& image) {
+  if (_cache.count(img_path) != 0U) {
+    _texture = _cache[img_path];
+    return;
+  }
+
+  upload(image);
+  _cache[img_path] = _texture;
+}
+
+auto Texture::id() const -> GLuint { return _texture; }
+
+void Texture::upload(const Image& image) {
   glGenTextures(1, &_texture);
   glBindTexture(GL_TEXTURE_2D, _texture);
   glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.width(), image.height(), 0, GL_RGBA, GL_UNSIGNED_BYTE, image.data());
@@ -35,8 +50,4 @@ Texture::Texture(const std::string& img_path) {
   // Max samples (EXT stands for extension, and thus not from OpenGL specification)
   float anisotropy = 16.0F;
   glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
-
-  _cache[img_path] = _texture;
 }
-
-auto Texture::id() const -> GLuint { return _texture; }
@@ -5,14 +5,21 @@
 
 namespace engine::graphics {
 
+  class Image;
+
   class Texture {
   public:
     Texture(const std::string& img_path);
 
+    /// @brief Uploads \p image, which was decoded from \p img_path beforehand, e.g. on a worker thread.
+    Texture(const std::string& img_path, const Image& image);
+
     // Accessors
     [[nodiscard]] auto id() const -> GLuint;
 
   private:
-    GLuint _texture;
+    GLuint _texture = 0;
+
+    void upload(const Image& image);
   };
 }
@@ -0,0 +1,86 @@
+#include "command_queue.hpp"
+
+#include "../debug/logger.hpp"
+
+#include <thread>
+
+using namespace engine::job;
+
+namespace {
+
+  /// @brief Rounds \p capacity up to a power of two, so that positions map to slots with a mask. Two slots are the minimum for the sequence numbers to work.
+  auto slot_count(std::size_t capacity) -> std::size_t {
+    if (capacity == 0)
+      LOG_ERROR("The capacity of a command queue must be positive.");
+
+    std::size_t count = 2;
+    while (count < capacity)
+      count *= 2;
+    return count;
+  }
+
+}
+
+CommandQueue::CommandQueue(std::size_t capacity)
+        : _slots(slot_count(capacity)),
+          _mask(_slots.size() - 1) {
+
+  for (std::size_t i = 0; i < _slots.size(); i++)
+    _slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+auto CommandQueue::try_push(std::function<void()>&& command) -> bool {
+  auto position = _tail.load(std::memory_order_relaxed);
+  while (true) {
+    auto& slot    = _slots[position & _mask];
+    auto sequence = slot.sequence.load(std::memory_order_acquire);
+    auto lag      = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+    if (lag == 0) {
+      // The slot is free, so claim it unless another producer was faster.
+      if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        slot.command = std::move(command);
+        slot.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (lag < 0) {
+      // The slot still holds the command from one lap ago.
+      return false;
+    } else {
+      position = _tail.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void CommandQueue::push(std::function<void()> command) {
+  while (!try_push(std::move(command)))
+    std::this_thread::yield();
+}
+
+auto CommandQueue::drain() -> std::size_t {
+  // Commands that are pushed while these run are left for the next call.
+  auto end = _tail.load(std::memory_order_acquire);
+
+  std::size_t count = 0;
+  while (_head != end) {
+    auto& slot = _slots[_head & _mask];
+
+    // The producer that claimed this position may not have stored its command yet.
+    if (slot.sequence.load(std::memory_order_acquire) != _head + 1)
+      break;
+
+    auto command = std::move(slot.command);
+    slot.command = nullptr;
+    slot.sequence.store(_head + _slots.size(), std::memory_order_release);
+    _head++;
+
+    command();
+    count++;
+  }
+
+  return count;
+}
+
+auto CommandQueue::capacity() const -> std::size_t {
+  return _slots.size();
+}
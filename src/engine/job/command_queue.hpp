@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace engine::job {
+
+  /// @brief CommandQueue is a bounded, lock-free queue of commands that any number of threads push into and a single thread drains.
+  ///
+  /// Every slot of the ring buffer carries a sequence number that tells producers and the consumer whose turn it is, so that a push only needs a single compare-and-swap while the queue is neither full nor contended.
+  ///
+  /// @see https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+  // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+  class CommandQueue {
+  public:
+    /// @brief Creates a queue that holds up to \p capacity commands, rounded up to the next power of two.
+    CommandQueue(std::size_t capacity);
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Pushes \p command, unless the queue is full. Can be called from any thread.
+    ///
+    /// Returns whether \p command was pushed. \p command is only moved from if it was.
+    auto try_push(std::function<void()>&& command) -> bool;
+
+    /// @brief Pushes \p command, and yields the calling thread while the queue is full. Can be called from any thread.
+    void push(std::function<void()> command);
+
+    /// @brief Pushes a command that calls \p func, and returns a future of its result. Can be called from any thread.
+    ///
+    /// If the queue is destroyed before the command ran, the future throws std::future_error with std::future_errc::broken_promise.
+    template <typename F>
+    auto submit(F func) -> std::future<std::invoke_result_t<F>>;
+
+    /// @brief Runs the commands that were pushed before the call, in the order they were pushed. Must only be called from the consuming thread.
+    ///
+    /// Returns the number of commands that ran.
+    auto drain() -> std::size_t;
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    [[nodiscard]] auto capacity() const -> std::size_t;
+
+    /// @}
+
+  private:
+    struct Slot {
+      std::atomic<std::size_t> sequence; //< the position the slot is free for, or that position + 1 once it holds a command
+      std::function<void()> command;
+    };
+
+    /// @{
+    /// Private state.
+    std::vector<Slot> _slots;
+    std::size_t _mask;
+    alignas(64) std::atomic<std::size_t> _tail = 0; //< next position to push to, shared by all producers
+    alignas(64) std::size_t _head              = 0; //< next position to pop from, only touched by the consumer
+    /// @}
+  };
+
+  template <typename F>
+  auto CommandQueue::submit(F func) -> std::future<std::invoke_result_t<F>> {
+    // NOTE: std::function must be copyable, which the task is not.
+    auto task   = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::move(func));
+    auto result = task->get_future();
+    push([task] { (*task)(); });
+    return result;
+  }
+
+}
@@ -0,0 +1,267 @@
+#include "job_system.hpp"
+
+#include "../debug/logger.hpp"
+
+#include <algorithm>
+
+using namespace engine::job;
+
+namespace {
+
+  /// The job system whose worker runs on this thread, if any.
+  thread_local const JobSystem* current_system = nullptr;
+
+  /// The index of the queue of the worker that runs on this thread.
+  thread_local std::size_t current_queue = 0;
+
+}
+
+JobSystem::Counter::Counter()
+        : _state(std::make_shared<State>()) {}
+
+auto JobSystem::Counter::is_done() const -> bool {
+  return _state->pending == 0;
+}
+
+JobSystem::JobSystem()
+        : JobSystem(std::max(1U, std::thread::hardware_concurrency()) - 1) {}
+
+JobSystem::JobSystem(unsigned int worker_count)
+        : _main_thread(std::this_thread::get_id()) {
+  _queues.reserve(worker_count + 1);
+  for (unsigned int i = 0; i <= worker_count; i++)
+    _queues.push_back(std::make_unique<Queue>());
+
+  _workers.reserve(worker_count);
+  for (unsigned int i = 0; i < worker_count; i++)
+    _workers.emplace_back(&JobSystem::work, this, i);
+}
+
+JobSystem::~JobSystem() {
+  {
+    const std::lock_guard<std::mutex> lock(_sleep_mutex);
+    _stopping = true;
+  }
+  _has_work.notify_all();
+
+  for (auto& worker : _workers)
+    worker.join();
+}
+
+void JobSystem::run(std::function<void()> job, const Counter& counter, Affinity affinity) {
+  push(counted(std::move(job), counter), affinity);
+}
+
+auto JobSystem::run(std::function<void()> job, Affinity affinity) -> Counter {
+  Counter counter;
+  run(std::move(job), counter, affinity);
+  return counter;
+}
+
+void JobSystem::run_after(const Counter& dependency, std::function<void()> job, const Counter& counter, Affinity affinity) {
+  auto wrapped = counted(std::move(job), counter);
+
+  // NOTE: finish() decrements before it locks, so either it sees the continuation or we see that the dependency is done.
+  {
+    const std::lock_guard<std::mutex> lock(dependency._state->mutex);
+    if (!dependency.is_done()) {
+      dependency._state->continuations.emplace_back([this, wrapped = std::move(wrapped), affinity]() mutable {
+        push(std::move(wrapped), affinity);
+      });
+      return;
+    }
+  }
+
+  push(std::move(wrapped), affinity);
+}
+
+auto JobSystem::run_after(const Counter& dependency, std::function<void()> job, Affinity affinity) -> Counter {
+  Counter counter;
+  run_after(dependency, std::move(job), counter, affinity);
+  return counter;
+}
+
+void JobSystem::wait(const Counter& counter) {
+  bool on_main_thread = is_main_thread();
+  auto has_main_job   = [&] {
+    const std::lock_guard<std::mutex> lock(_main_queue.mutex);
+    return !_main_queue.jobs.empty();
+  };
+
+  _waiting++;
+  while (!counter.is_done()) {
+    std::function<void()> job;
+    if (try_pop(job)) {
+      job();
+      continue;
+    }
+
+    if (on_main_thread && has_main_job()) {
+      run_main_thread_jobs();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(_sleep_mutex);
+    _has_work.wait(lock, [&] {
+      return counter.is_done() || _queued > 0 || (on_main_thread && has_main_job());
+    });
+  }
+  _waiting--;
+}
+
+void JobSystem::run_main_thread_jobs() {
+  if (!is_main_thread())
+    LOG_ERROR("Main thread jobs can only be run on the main thread.");
+
+  // Jobs that are scheduled while these run are left for the next call.
+  std::deque<std::function<void()>> jobs;
+  {
+    const std::lock_guard<std::mutex> lock(_main_queue.mutex);
+    jobs.swap(_main_queue.jobs);
+  }
+
+  for (auto& job : jobs)
+    job();
+}
+
+void JobSystem::parallel_for(std::size_t count,
+                             std::size_t min_chunk_size,
+                             const std::function<void(std::size_t, std::size_t)>& func) {
+  if (count == 0)
+    return;
+
+  // Aim for a few chunks per thread so that uneven chunks balance out.
+  std::size_t threads    = _workers.size() + 1;
+  std::size_t chunk_size = std::max(std::max<std::size_t>(min_chunk_size, 1), count / (4 * threads));
+  std::size_t chunks     = (count + chunk_size - 1) / chunk_size;
+
+  if (chunks == 1 || _workers.empty()) {
+    func(0, count);
+    return;
+  }
+
+  // Chunks are claimed through an atomic counter, so the queues only hold one helper job per participating worker.
+  auto next_chunk = std::make_shared<std::atomic<std::size_t>>(0);
+  auto run_chunks = [next_chunk, count, chunk_size, chunks, &func] {
+    for (auto i = (*next_chunk)++; i < chunks; i = (*next_chunk)++)
+      func(i * chunk_size, std::min(count, (i + 1) * chunk_size));
+  };
+
+  Counter helpers;
+  for (std::size_t i = 0; i < std::min<std::size_t>(_workers.size(), chunks - 1); i++)
+    run(run_chunks, helpers);
+
+  run_chunks();
+  wait(helpers);
+}
+
+auto JobSystem::worker_count() const -> unsigned int {
+  return _workers.size();
+}
+
+void JobSystem::set_main_thread() {
+  _main_thread = std::this_thread::get_id();
+}
+
+auto JobSystem::is_main_thread() const -> bool {
+  return std::this_thread::get_id() == _main_thread;
+}
+
+void JobSystem::work(std::size_t index) {
+  current_system = this;
+  current_queue  = index;
+
+  while (true) {
+    std::function<void()> job;
+    if (try_pop(job)) {
+      job();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(_sleep_mutex);
+    _has_work.wait(lock, [this] { return _stopping || _queued > 0; });
+
+    if (_stopping && _queued == 0)
+      return;
+  }
+}
+
+void JobSystem::push(std::function<void()> job, Affinity affinity) {
+  if (affinity == Affinity::MAIN_THREAD) {
+    const std::lock_guard<std::mutex> lock(_main_queue.mutex);
+    _main_queue.jobs.push_back(std::move(job));
+  } else {
+    auto& queue = *_queues[current_system == this ? current_queue : _workers.size()];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.jobs.push_back(std::move(job));
+    _queued++;
+  }
+
+  notify();
+}
+
+auto JobSystem::try_pop(std::function<void()>& job) -> bool {
+  std::size_t own = current_system == this ? current_queue : _workers.size();
+
+  // The own queue is used as a stack, since its newest jobs are most likely still in the cache.
+  {
+    auto& queue = *_queues[own];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+      _queued--;
+      return true;
+    }
+  }
+
+  // Other queues are stolen from at the front, where the oldest and usually largest jobs are.
+  for (std::size_t i = 1; i < _queues.size(); i++) {
+    auto& queue = *_queues[(own + i) % _queues.size()];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+      _queued--;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+auto JobSystem::counted(std::function<void()> job, const Counter& counter) -> std::function<void()> {
+  counter._state->pending++;
+  return [this, job = std::move(job), counter] {
+    job();
+    finish(counter);
+  };
+}
+
+void JobSystem::finish(const Counter& counter) {
+  if (--counter._state->pending != 0)
+    return;
+
+  std::vector<std::function<void()>> continuations;
+  {
+    const std::lock_guard<std::mutex> lock(counter._state->mutex);
+    continuations.swap(counter._state->continuations);
+  }
+  for (auto& continuation : continuations)
+    continuation();
+
+  if (_waiting > 0)
+    notify();
+}
+
+void JobSystem::notify() {
+  {
+    const std::lock_guard<std::mutex> lock(_sleep_mutex);
+  }
+
+  // Threads in wait() sleep on the same condition, so waking only one might miss the worker.
+  if (_waiting > 0)
+    _has_work.notify_all();
+  else
+    _has_work.notify_one();
+}
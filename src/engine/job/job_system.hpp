@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::job {
+
+  /// @brief Where a job may run.
+  enum class Affinity {
+    ANY,         //< on any worker, or on a thread that waits for it
+    MAIN_THREAD, //< only on the main thread, which owns the graphics contexts, see JobSystem::set_main_thread()
+  };
+
+  /// @brief JobSystem owns a fixed set of worker threads that engine systems can distribute work onto.
+  ///
+  /// Each worker has its own deque of jobs. Workers run their own newest jobs first and steal the oldest jobs of other workers when they run out.
+  /// Jobs can depend on counters of other jobs, and threads that wait for a counter run pending jobs until it is done.
+  // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+  class JobSystem {
+  public:
+    /// @brief Counter tracks a group of jobs, which other jobs can depend on and threads can wait for.
+    ///
+    /// Copies refer to the same group.
+    class Counter {
+    public:
+      Counter();
+
+      /// @brief Checks if all jobs of the group are done.
+      [[nodiscard]] auto is_done() const -> bool;
+
+    private:
+      friend class JobSystem;
+
+      struct State {
+        std::atomic<std::size_t> pending = 0;
+        std::mutex mutex;
+        std::vector<std::function<void()>> continuations; //< scheduled once pending drops to 0
+      };
+
+      std::shared_ptr<State> _state;
+    };
+
+    /// @brief Creates a job system with one worker per hardware thread, except for the calling thread.
+    JobSystem();
+
+    /// @brief Creates a job system with \p worker_count worker threads.
+    ///
+    /// A job system without workers is valid and runs all work on the threads that wait for it.
+    /// The calling thread becomes the main thread, see Affinity::MAIN_THREAD.
+    JobSystem(unsigned int worker_count);
+
+    ~JobSystem();
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Schedules \p job and adds it to the group of \p counter.
+    void run(std::function<void()> job, const Counter& counter, Affinity affinity = Affinity::ANY);
+
+    /// @brief Schedules \p job, and returns a counter that is done once the job is done.
+    auto run(std::function<void()> job, Affinity affinity = Affinity::ANY) -> Counter;
+
+    /// @brief Schedules \p job once all jobs of \p dependency are done, and adds it to the group of \p counter right away.
+    void run_after(const Counter& dependency, std::function<void()> job, const Counter& counter, Affinity affinity = Affinity::ANY);
+
+    /// @brief Schedules \p job once all jobs of \p dependency are done, and returns a counter that is done once the job is done.
+    auto run_after(const Counter& dependency, std::function<void()> job, Affinity affinity = Affinity::ANY) -> Counter;
+
+    /// @brief Returns once all jobs of \p counter are done, and runs pending jobs on the calling thread meanwhile.
+    ///
+    /// The main thread also runs main thread jobs while it waits.
+    void wait(const Counter& counter);
+
+    /// @brief Runs all main thread jobs that are currently pending. Must be called on the main thread.
+    void run_main_thread_jobs();
+
+    /// @brief Makes the calling thread the main thread, e.g. once a render thread has taken over the graphics contexts.
+    void set_main_thread();
+
+    /// @brief Splits the range [0, \p count) into chunks of at least \p min_chunk_size indices and calls \p func(begin, end) for each chunk.
+    ///
+    /// The chunks are processed concurrently by the workers and the calling thread.
+    /// Returns once all chunks are done.
+    void parallel_for(std::size_t count,
+                      std::size_t min_chunk_size,
+                      const std::function<void(std::size_t, std::size_t)>& func);
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    [[nodiscard]] auto worker_count() const -> unsigned int;
+
+    /// @brief Checks if the calling thread is the main thread.
+    [[nodiscard]] auto is_main_thread() const -> bool;
+
+    /// @}
+
+  private:
+    struct Queue {
+      std::mutex mutex;
+      std::deque<std::function<void()>> jobs;
+    };
+
+    /// @{
+    /// Private state.
+    std::atomic<std::thread::id> _main_thread;
+    std::vector<std::thread> _workers;
+    std::vector<std::unique_ptr<Queue>> _queues; //< one per worker, plus a last one for all other threads
+    Queue _main_queue;
+    std::atomic<std::size_t> _queued = 0;        //< jobs in _queues, not counting _main_queue
+    std::atomic<unsigned int> _waiting = 0;      //< threads in wait() that must be notified when a counter is done
+    std::mutex _sleep_mutex;
+    std::condition_variable _has_work;
+    bool _stopping = false;
+    /// @}
+
+    void work(std::size_t index);
+
+    /// @brief Pushes \p job onto the queue of the calling thread, or onto the main queue.
+    void push(std::function<void()> job, Affinity affinity);
+
+    /// @brief Pops a job of the calling thread's own queue, or steals one from another queue.
+    auto try_pop(std::function<void()>& job) -> bool;
+
+    /// @brief Wraps \p job so that it finishes its part of \p counter once it ran.
+    auto counted(std::function<void()> job, const Counter& counter) -> std::function<void()>;
+
+    void finish(const Counter& counter);
+    void notify();
+  };
+
+}
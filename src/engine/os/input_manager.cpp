@@ -1,61 +1,133 @@
 #include "input_manager.hpp"
 
-#include <algorithm>
+#include "../debug/logger.hpp"
 
 using namespace engine::os;
 
-void InputManager::add_window(Window& window) {
-  _windows.emplace_back(window);
+InputManager::InputManager(std::size_t event_capacity)
+        : _events(event_capacity) {
+  if (event_capacity == 0)
+    LOG_ERROR("The input event buffer must hold at least one event.");
+}
 
+void InputManager::add_window(Window& window) {
   window.on_key([this, &window](KeyCode code, KeyAction action, const ActivatedModifiers& mods) {
-    for (auto& c : _on_key_callbacks)
-      c(window, code, action, mods);
+    push_key(window, code, action, mods);
   });
 
   window.on_mouse_click([this, &window](MouseCode code, MouseAction action, const ActivatedModifiers& mods) {
-    for (auto& c : _on_mouse_click_callbacks)
-      c(window, code, action, mods);
+    push_mouse_click(window, code, action, mods);
   });
 
   window.on_mouse_move([this, &window](float x, float y) {
-    for (auto& c : _on_mouse_move_callbacks)
-      c(window, x, y);
+    push_mouse_move(window, x, y);
   });
 
   window.on_mouse_scroll([this, &window](float x, float y) {
-    for (auto& c : _on_mouse_scroll_callbacks)
-      c(window, x, y);
+    push_mouse_scroll(window, x, y);
   });
 }
 
 void InputManager::remove_window(Window& window) {
-  for (unsigned int i = 0; i < _windows.size(); i++) {
-    if (&_windows[i].get() == &window) {
-      _windows.erase(_windows.begin() + i);
+  for (std::size_t i = 0; i < _count; i++) {
+    auto& event = _events[(_first + i) % _events.size()];
+    if (event.window == &window)
+      event.window = nullptr;
+  }
+}
+
+void InputManager::dispatch_events() {
+  if (_dropped > 0) {
+    LOG_WARNING("Dropped " + std::to_string(_dropped) + " input events since the input event buffer was full.");
+    _dropped = 0;
+  }
+
+  // NOTE: Events are only pushed while polling, so callbacks can't add to the buffer while it is dispatched.
+  for (; _count > 0; _count--, _first = (_first + 1) % _events.size()) {
+    const auto& event = _events[_first];
+    if (event.window == nullptr)
+      continue;
+
+    switch (event.type) {
+    case Event::Type::KEY:
+      _on_key.trigger(*event.window, event.code, static_cast<KeyAction>(event.action), event.modifiers);
+      break;
+    case Event::Type::MOUSE_CLICK:
+      _on_mouse_click.trigger(*event.window, event.code, static_cast<MouseAction>(event.action), event.modifiers);
+      break;
+    case Event::Type::MOUSE_MOVE:
+      _on_mouse_move.trigger(*event.window, event.x, event.y);
+      break;
+    case Event::Type::MOUSE_SCROLL:
+      _on_mouse_scroll.trigger(*event.window, event.x, event.y);
       break;
     }
   }
 }
 
-void InputManager::on_key(const std::function<void(const Window&, KeyCode, KeyAction, const ActivatedModifiers&)>& callback) const {
-  _on_key_callbacks.push_back(callback);
+void InputManager::push_key(const Window& window, KeyCode code, KeyAction action, const ActivatedModifiers& mods) {
+  if (code >= 0 && code < (int) _keys_down.size())
+    _keys_down[code] = action != KeyAction::RELEASE;
+
+  push({Event::Type::KEY, &window, code, (int) action, mods});
 }
 
-void InputManager::on_mouse_click(const std::function<void(const Window&, MouseCode, MouseAction, const ActivatedModifiers&)>& callback) const {
-  _on_mouse_click_callbacks.push_back(callback);
+void InputManager::push_mouse_click(const Window& window, MouseCode code, MouseAction action, const ActivatedModifiers& mods) {
+  if (code >= 0 && code < (int) _mouse_buttons_down.size())
+    _mouse_buttons_down[code] = action == MouseAction::PRESS;
+
+  push({Event::Type::MOUSE_CLICK, &window, code, (int) action, mods});
 }
 
-void InputManager::on_mouse_move(const std::function<void(const Window&, float, float)>& callback) const {
-  _on_mouse_move_callbacks.push_back(callback);
+void InputManager::push_mouse_move(const Window& window, float x, float y) {
+  // Only the latest position matters, so consecutive moves share an event.
+  if (_count > 0) {
+    auto& last = _events[(_first + _count - 1) % _events.size()];
+    if (last.type == Event::Type::MOUSE_MOVE && last.window == &window) {
+      last.x = x;
+      last.y = y;
+      return;
+    }
+  }
+
+  push({Event::Type::MOUSE_MOVE, &window, 0, 0, {}, x, y});
+}
+
+void InputManager::push_mouse_scroll(const Window& window, float x, float y) {
+  push({Event::Type::MOUSE_SCROLL, &window, 0, 0, {}, x, y});
+}
+
+auto InputManager::on_key(const std::function<void(const Window&, KeyCode, KeyAction, const ActivatedModifiers&)>& callback) const -> architecture::Subscription {
+  return _on_key.listen(callback);
+}
+
+auto InputManager::on_mouse_click(const std::function<void(const Window&, MouseCode, MouseAction, const ActivatedModifiers&)>& callback) const -> architecture::Subscription {
+  return _on_mouse_click.listen(callback);
 }
 
-void InputManager::on_mouse_scroll(const std::function<void(const Window&, float, float)>& callback) const {
-  _on_mouse_scroll_callbacks.push_back(callback);
+auto InputManager::on_mouse_move(const std::function<void(const Window&, float, float)>& callback) const -> architecture::Subscription {
+  return _on_mouse_move.listen(callback);
+}
+
+auto InputManager::on_mouse_scroll(const std::function<void(const Window&, float, float)>& callback) const -> architecture::Subscription {
+  return _on_mouse_scroll.listen(callback);
 }
 
 auto InputManager::is_key_down(KeyCode keycode) const -> bool {
-  for (const auto& w : _windows)
-    if (w.get().is_key_down(keycode))
-      return true;
-  return false;
+  return keycode >= 0 && keycode < (int) _keys_down.size() && _keys_down[keycode];
+}
+
+auto InputManager::is_mouse_button_down(MouseCode mousecode) const -> bool {
+  return mousecode >= 0 && mousecode < (int) _mouse_buttons_down.size() && _mouse_buttons_down[mousecode];
+}
+
+void InputManager::push(const Event& event) {
+  if (_count == _events.size()) {
+    _first = (_first + 1) % _events.size();
+    _count--;
+    _dropped++;
+  }
+
+  _events[(_first + _count) % _events.size()] = event;
+  _count++;
 }
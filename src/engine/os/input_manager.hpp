@@ -2,31 +2,94 @@
 
 #include "window.hpp"
 
+#include "../architecture/event.hpp"
+
+#include <bitset>
+#include <cstddef>
 #include <functional>
 #include <vector>
 
 namespace engine::os {
 
+  /// @brief InputManager buffers the input events of all windows, and hands them to its listeners once per update.
+  ///
+  /// WindowManager::poll_events() fills a preallocated ring buffer, and dispatch_events() empties it into the callbacks on the update tick.
+  /// Key and mouse button states are tracked as events are polled, so querying them does not call into GLFW.
+  ///
   /// @todo Have InputManager listen to window manager and its windows instead of having add_window() and remove_window()
   class InputManager {
   public:
+    /// @brief Creates an input manager that buffers up to \p event_capacity events between two dispatches.
+    InputManager(std::size_t event_capacity = 1024);
+
     void add_window(Window& window);
+
+    /// @brief Stops listening to \p window and discards its pending events.
     void remove_window(Window& window);
 
-    void on_key(const std::function<void(const Window&, KeyCode, KeyAction, const ActivatedModifiers&)>& callback) const;
-    void on_mouse_click(const std::function<void(const Window&, MouseCode, MouseAction, const ActivatedModifiers&)>& callback) const;
-    void on_mouse_move(const std::function<void(const Window&, float, float)>& callback) const;
-    void on_mouse_scroll(const std::function<void(const Window&, float, float)>& callback) const;
+    /// @brief Calls the callbacks with the events that were polled since the last call, in the order they were polled.
+    void dispatch_events();
+
+    /// @name Input events
+    /// Buffers an input event of \p window until the next dispatch_events(). Called by the windows that were added, and can be used to simulate input.
+    /// @{
+    void push_key(const Window& window, KeyCode code, KeyAction action, const ActivatedModifiers& mods);
+    void push_mouse_click(const Window& window, MouseCode code, MouseAction action, const ActivatedModifiers& mods);
+    void push_mouse_move(const Window& window, float x, float y);
+    void push_mouse_scroll(const Window& window, float x, float y);
+    /// @}
+
+    /// @name Listeners
+    /// Calls \p callback with the events of its type until the returned subscription ends.
+    /// Listeners that capture `this` must hold on to the subscription, so that they aren't called after they are destroyed.
+    /// @{
+    [[nodiscard]] auto on_key(const std::function<void(const Window&, KeyCode, KeyAction, const ActivatedModifiers&)>& callback) const -> architecture::Subscription;
+    [[nodiscard]] auto on_mouse_click(const std::function<void(const Window&, MouseCode, MouseAction, const ActivatedModifiers&)>& callback) const -> architecture::Subscription;
+    [[nodiscard]] auto on_mouse_move(const std::function<void(const Window&, float, float)>& callback) const -> architecture::Subscription;
+    [[nodiscard]] auto on_mouse_scroll(const std::function<void(const Window&, float, float)>& callback) const -> architecture::Subscription;
+    /// @}
 
+    /// @brief Checks if \p keycode is held down in any window, as of the last poll.
     auto is_key_down(KeyCode keycode) const -> bool;
 
+    /// @brief Checks if \p mousecode is held down in any window, as of the last poll.
+    auto is_mouse_button_down(MouseCode mousecode) const -> bool;
+
   private:
-    mutable std::vector<std::function<void(const Window&, KeyCode, KeyAction, const ActivatedModifiers&)>> _on_key_callbacks;
-    mutable std::vector<std::function<void(const Window&, MouseCode, MouseAction, const ActivatedModifiers&)>> _on_mouse_click_callbacks;
-    mutable std::vector<std::function<void(const Window&, float, float)>> _on_mouse_move_callbacks;
-    mutable std::vector<std::function<void(const Window&, float, float)>> _on_mouse_scroll_callbacks;
+    struct Event {
+      enum class Type {
+        KEY,
+        MOUSE_CLICK,
+        MOUSE_MOVE,
+        MOUSE_SCROLL
+      };
+
+      Type type            = Type::KEY;
+      const Window* window = nullptr; //< null once the window is removed
+      int code             = 0;       //< the KeyCode or MouseCode
+      int action           = 0;       //< the KeyAction or MouseAction
+      ActivatedModifiers modifiers;
+      float x = 0.0F; //< the cursor position or scroll offset
+      float y = 0.0F;
+    };
+
+    /// @brief Appends \p event to the ring buffer, and overwrites the oldest event if it is full.
+    void push(const Event& event);
+
+    /// @{
+    /// Private state.
+    std::vector<Event> _events; //< ring buffer of the pending events
+    std::size_t _first   = 0;   //< index of the oldest pending event
+    std::size_t _count   = 0;   //< number of pending events
+    std::size_t _dropped = 0;   //< events overwritten since the last dispatch
+    std::bitset<GLFW_KEY_LAST + 1> _keys_down;
+    std::bitset<GLFW_MOUSE_BUTTON_LAST + 1> _mouse_buttons_down;
 
-    std::vector<std::reference_wrapper<Window>> _windows;
+    architecture::Event<void(const Window&, KeyCode, KeyAction, const ActivatedModifiers&)> _on_key;
+    architecture::Event<void(const Window&, MouseCode, MouseAction, const ActivatedModifiers&)> _on_mouse_click;
+    architecture::Event<void(const Window&, float, float)> _on_mouse_move;
+    architecture::Event<void(const Window&, float, float)> _on_mouse_scroll;
+    /// @}
   };
 
 }
@@ -9,6 +9,27 @@
 
 using namespace engine::os;
 
+namespace {
+
+  /// @brief Maps a GLFW key action, whose values differ from the order of KeyAction.
+  auto to_key_action(int action) -> KeyAction {
+    switch (action) {
+    case GLFW_PRESS:
+      return KeyAction::PRESS;
+    case GLFW_REPEAT:
+      return KeyAction::REPEAT;
+    default:
+      return KeyAction::RELEASE;
+    }
+  }
+
+  /// @brief Maps a GLFW mouse button action, whose values differ from the order of MouseAction.
+  auto to_mouse_action(int action) -> MouseAction {
+    return action == GLFW_PRESS ? MouseAction::PRESS : MouseAction::RELEASE;
+  }
+
+}
+
 Window::Window()
         : Window(1280, 720) {}
 
@@ -73,7 +94,7 @@ Window::Window(unsigned int width, unsigned int height, const char* title, Windo
     modifiers.num_lock  = (bool) (mods & 0x20);
 
     for (auto& c : w->_on_key_callbacks)
-      c(key, static_cast<KeyAction>(action), modifiers);
+      c(key, to_key_action(action), modifiers);
   });
 
   glfwSetMouseButtonCallback(_window.get(), [](GLFWwindow* window, int button, int action, int mods) {
@@ -88,7 +109,7 @@ Window::Window(unsigned int width, unsigned int height, const char* title, Windo
     modifiers.num_lock  = (bool) (mods & 0x20);
 
     for (auto& c : w->_on_mouse_click_callbacks)
-      c(button, static_cast<MouseAction>(action), modifiers);
+      c(button, to_mouse_action(action), modifiers);
   });
 
   glfwSetCursorPosCallback(_window.get(), [](GLFWwindow* window, double xpos, double ypos) {
@@ -139,7 +160,6 @@ void Window::init_gui() {
 
 void Window::update() {
   glfwSwapBuffers(_window.get());
-  glfwPollEvents();
 }
 
 void Window::clear_screen() const {
@@ -59,10 +59,9 @@ void WindowManager::create_window() {
 
   _input_manager.add_window(*_windows[id]);
 
-  _windows[id]->on_should_close([this, id]() {
-    LOG_INFO("Closing window with ID " + std::to_string(id) + ".");
-    _input_manager.remove_window(*_windows[id]);
-    destroy_window(id);
+  // NOTE: Another thread may be rendering to the window, so it is only destroyed in close_requested_windows().
+  _windows[id]->on_should_close([this, window = _windows[id].get()]() {
+    _close_requests.push_back(window);
   });
   // _windows.back()->init_gui();
 }
@@ -90,6 +89,10 @@ void WindowManager::set_render_target(unsigned int window_id) {
   _windows[_current]->set_as_current();
 }
 
+void WindowManager::release_render_target() {
+  glfwMakeContextCurrent(nullptr);
+}
+
 void WindowManager::clear_target() {
   _windows[_current]->clear_screen();
 }
@@ -98,6 +101,28 @@ void WindowManager::refresh_target() {
   _windows[_current]->update();
 }
 
+void WindowManager::poll_events() {
+  glfwPollEvents();
+}
+
+void WindowManager::dispatch_input_events() {
+  _input_manager.dispatch_events();
+}
+
+void WindowManager::close_requested_windows() {
+  for (const auto* window : _close_requests) {
+    for (unsigned int id = 0; id < _windows.size(); id++) {
+      if (_windows[id].get() != window)
+        continue;
+
+      LOG_INFO("Closing window with ID " + std::to_string(id) + ".");
+      destroy_window(id);
+      break;
+    }
+  }
+  _close_requests.clear();
+}
+
 auto WindowManager::input_manager() const -> const InputManager& {
   return _input_manager;
 }
@@ -114,6 +139,10 @@ auto WindowManager::window_count() const -> unsigned int {
   return _windows.size();
 }
 
+auto WindowManager::has_close_requests() const -> bool {
+  return !_close_requests.empty();
+}
+
 void WindowManager::on_window_created(const std::function<void(unsigned int)>& callback) const {
   _on_window_created_callbacks.push_back(callback);
 }
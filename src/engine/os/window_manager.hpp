@@ -27,11 +27,28 @@ namespace engine::os {
     /// A context must only be made current on a single thread at a time and each thread can have only a single current context at a time.
     void set_render_target(unsigned int window_id);
 
+    /// @brief Detaches the OpenGL context from this thread, so that another thread can make it current.
+    void release_render_target();
+
     void clear_target();
 
-    /// @brief Swaps front/back buffers of the current render target, and also polls for input events.
+    /// @brief Swaps front/back buffers of the current render target.
     void refresh_target();
 
+    /// @brief Processes the pending window events, and buffers the input events in the InputManager.
+    ///
+    /// Must be called on the thread that created the window manager.
+    /// Windows that are asked to close are only destroyed by close_requested_windows().
+    void poll_events();
+
+    /// @brief Calls the input callbacks with the input events buffered since the last call, see InputManager::dispatch_events().
+    void dispatch_input_events();
+
+    /// @brief Destroys the windows that were asked to close.
+    ///
+    /// Must be called on the thread that created the window manager, while no other thread has the context of one of these windows current.
+    void close_requested_windows();
+
     /// @}
     /// @name Accessors
     /// @{
@@ -41,6 +58,9 @@ namespace engine::os {
     [[nodiscard]] auto render_target() const -> const Window&;
     [[nodiscard]] auto window_count() const -> unsigned int;
 
+    /// @brief Checks if a window was asked to close since the last close_requested_windows().
+    [[nodiscard]] auto has_close_requests() const -> bool;
+
     /// @}
     /// @name Events
     /// @{
@@ -59,6 +79,7 @@ namespace engine::os {
     std::unique_ptr<Window> _base_window; //< Owns the base OpenGL context from which other windows share/derive.
     std::vector<std::unique_ptr<Window>> _windows;
     InputManager _input_manager;
+    std::vector<const Window*> _close_requests;
 
     mutable std::vector<std::function<void(unsigned int)>> _on_window_created_callbacks;
     mutable std::vector<std::function<void(unsigned int)>> _on_window_closed_callbacks;
@@ -3,9 +3,33 @@
 using namespace engine;
 using namespace engine::scene;
 
-SceneAPI::SceneAPI(const os::InputManager& input_manager)
-        : _input_manager(std::ref(input_manager)) {}
+SceneAPI::SceneAPI(const os::InputManager& input_manager,
+                   Manager& scene_manager,
+                   job::JobSystem& jobs,
+                   time::TaskQueue& tasks,
+                   graphics::AssetLoader& assets)
+        : _input_manager(std::ref(input_manager)),
+          _scene_manager(scene_manager),
+          _jobs(jobs),
+          _tasks(tasks),
+          _assets(assets) {}
 
 auto SceneAPI::input_manager() const -> const os::InputManager& {
   return _input_manager;
 }
+
+auto SceneAPI::scene_manager() const -> Manager& {
+  return _scene_manager;
+}
+
+auto SceneAPI::jobs() const -> job::JobSystem& {
+  return _jobs;
+}
+
+auto SceneAPI::tasks() const -> time::TaskQueue& {
+  return _tasks;
+}
+
+auto SceneAPI::assets() const -> graphics::AssetLoader& {
+  return _assets;
+}
@@ -1,11 +1,16 @@
 #pragma once
 
+#include "../graphics/asset_loader.hpp"
 #include "../graphics/camera.hpp"
 #include "../graphics/renderer.hpp"
+#include "../job/job_system.hpp"
 #include "../os/input_manager.hpp"
+#include "../time/task_queue.hpp"
 
 namespace engine::scene {
 
+  class Manager;
+
   /// The API exposed to the scenes.
   ///
   /// @todo Consider making an interface.
@@ -13,14 +18,36 @@ namespace engine::scene {
   /// @todo Figure out a better camera solution.
   class SceneAPI {
   public:
-    SceneAPI(const os::InputManager& input_manager);
+    SceneAPI(const os::InputManager& input_manager,
+             Manager& scene_manager,
+             job::JobSystem& jobs,
+             time::TaskQueue& tasks,
+             graphics::AssetLoader& assets);
 
     [[nodiscard]] auto input_manager() const -> const os::InputManager&;
 
+    /// @brief The manager of all scenes, which lets scripts load, unload, enable, and disable scenes.
+    [[nodiscard]] auto scene_manager() const -> Manager&;
+
+    /// @brief The job system of the engine, which scripts use to run work on the worker threads instead of spawning their own.
+    ///
+    /// Jobs that call the graphics API must use job::Affinity::MAIN_THREAD.
+    [[nodiscard]] auto jobs() const -> job::JobSystem&;
+
+    /// @brief The task queue of the engine, which spreads expensive work that must run on the engine thread over several updates.
+    [[nodiscard]] auto tasks() const -> time::TaskQueue&;
+
+    /// @brief The asset loader of the engine, which loads textures, shaders, and models in the background.
+    [[nodiscard]] auto assets() const -> graphics::AssetLoader&;
+
     graphics::Camera* camera = nullptr;
 
   private:
     std::reference_wrapper<const os::InputManager> _input_manager;
+    std::reference_wrapper<Manager> _scene_manager;
+    std::reference_wrapper<job::JobSystem> _jobs;
+    std::reference_wrapper<time::TaskQueue> _tasks;
+    std::reference_wrapper<graphics::AssetLoader> _assets;
   };
 
 }
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+namespace engine::scene::component {
+
+  /// @brief Name lets a node be looked up by name or by its path in the scene hierarchy.
+  ///
+  /// Names should be unique among siblings, since paths are resolved one child name at a time.
+  struct Name {
+    std::string name;
+  };
+
+}
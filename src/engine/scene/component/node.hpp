@@ -2,14 +2,20 @@
 
 #include "../../architecture/ecs.hpp"
 
-#include <set>
-
 namespace engine::scene::component {
 
   /// @brief Node represents a node in a scene hierarchy.
+  ///
+  /// The children of a node form an intrusive doubly linked list through the sibling fields, so the hierarchy lives entirely in the contiguous Node pool rather than in per-node heap containers.
+  /// Use the functions in hierarchy.hpp to modify these fields.
   struct Node {
-    architecture::EntityID parent = architecture::NullEntityID;
-    std::set<architecture::EntityID> children;
+    architecture::EntityID parent       = architecture::NullEntityID;
+    architecture::EntityID first_child  = architecture::NullEntityID;
+    architecture::EntityID last_child   = architecture::NullEntityID;
+    architecture::EntityID prev_sibling = architecture::NullEntityID;
+    architecture::EntityID next_sibling = architecture::NullEntityID;
+    unsigned int child_count            = 0;
+    unsigned int depth                  = 0; //< Distance to the root of the hierarchy.
   };
 
 }
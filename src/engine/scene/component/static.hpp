@@ -0,0 +1,13 @@
+#pragma once
+
+namespace engine::scene::component {
+
+  /// @brief Static marks a node that never changes after it has been loaded.
+  ///
+  /// Static nodes have their global transform computed once and are skipped by all per-frame transform work.
+  /// Use Node::make_static() to mark a whole subtree.
+  struct Static {
+    bool baked = false; //< Whether the global transform of the node has been computed.
+  };
+
+}
@@ -14,6 +14,11 @@ namespace engine::scene {
   struct IFactory {
     virtual ~IFactory() = default;
 
+    /// @brief Loads what the script needs before it is created, e.g. by reading files or by starting to load assets through SceneAPI::assets().
+    ///
+    /// Runs on a background thread if the scene is loaded with Manager::load_async(), so it may only use the jobs, tasks, and assets of \p api.
+    virtual void load_assets([[maybe_unused]] SceneAPI& api) {}
+
     virtual auto create(SceneAPI& api, Node& node) -> std::unique_ptr<IScript> = 0;
   };
 
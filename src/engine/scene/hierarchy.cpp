@@ -0,0 +1,158 @@
+#include "hierarchy.hpp"
+
+#include "component/static.hpp"
+#include "name_index.hpp"
+
+#include "../debug/logger.hpp"
+
+#include <algorithm>
+
+using namespace engine;
+using namespace engine::scene;
+
+namespace {
+
+  void invalidate_order(architecture::ECS& ecs) {
+    if (auto* cache = ecs.try_ctx<CachedOrder>(); cache != nullptr)
+      cache->valid = false;
+  }
+
+  void update_depths(architecture::ECS& ecs, architecture::EntityID subtree_root, unsigned int depth) {
+    ecs.get<component::Node>(subtree_root).depth = depth;
+    for_each_child(ecs, subtree_root, [&](architecture::EntityID child) {
+      update_depths(ecs, child, depth + 1);
+    });
+  }
+
+}
+
+void engine::scene::attach(architecture::ECS& ecs, architecture::EntityID parent, architecture::EntityID child) {
+  auto& child_node = ecs.get<component::Node>(child);
+  if (child_node.parent != architecture::NullEntityID)
+    LOG_ERROR("Can't attach a node that already has a parent.");
+
+  auto& parent_node = ecs.get<component::Node>(parent);
+
+  child_node.parent       = parent;
+  child_node.prev_sibling = parent_node.last_child;
+  child_node.next_sibling = architecture::NullEntityID;
+
+  if (parent_node.last_child != architecture::NullEntityID)
+    ecs.get<component::Node>(parent_node.last_child).next_sibling = child;
+  else
+    parent_node.first_child = child;
+
+  parent_node.last_child = child;
+  parent_node.child_count++;
+
+  update_depths(ecs, child, parent_node.depth + 1);
+  update_name_index_parent(ecs, child);
+  invalidate_order(ecs);
+}
+
+void engine::scene::detach(architecture::ECS& ecs, architecture::EntityID child) {
+  auto& child_node = ecs.get<component::Node>(child);
+  if (child_node.parent == architecture::NullEntityID)
+    return;
+
+  auto& parent_node = ecs.get<component::Node>(child_node.parent);
+
+  if (child_node.prev_sibling != architecture::NullEntityID)
+    ecs.get<component::Node>(child_node.prev_sibling).next_sibling = child_node.next_sibling;
+  else
+    parent_node.first_child = child_node.next_sibling;
+
+  if (child_node.next_sibling != architecture::NullEntityID)
+    ecs.get<component::Node>(child_node.next_sibling).prev_sibling = child_node.prev_sibling;
+  else
+    parent_node.last_child = child_node.prev_sibling;
+
+  parent_node.child_count--;
+
+  child_node.parent       = architecture::NullEntityID;
+  child_node.prev_sibling = architecture::NullEntityID;
+  child_node.next_sibling = architecture::NullEntityID;
+
+  update_depths(ecs, child, 0);
+  update_name_index_parent(ecs, child);
+  invalidate_order(ecs);
+}
+
+auto engine::scene::subtree(const architecture::ECS& ecs, architecture::EntityID root) -> std::vector<architecture::EntityID> {
+  std::vector<architecture::EntityID> entities;
+  std::vector<architecture::EntityID> stack = {root};
+  while (!stack.empty()) {
+    auto e = stack.back();
+    stack.pop_back();
+    entities.push_back(e);
+
+    // Push in reverse so that children are visited in the order they were attached.
+    auto child = ecs.get<component::Node>(e).last_child;
+    while (child != architecture::NullEntityID) {
+      stack.push_back(child);
+      child = ecs.get<component::Node>(child).prev_sibling;
+    }
+  }
+
+  return entities;
+}
+
+auto engine::scene::destroy_subtree(architecture::ECS& ecs, architecture::EntityID root) -> std::vector<architecture::EntityID> {
+  if (ecs.get<component::Node>(root).parent != architecture::NullEntityID)
+    detach(ecs, root);
+
+  auto entities = subtree(ecs, root);
+  ecs.destroy(entities.rbegin(), entities.rend());
+
+  invalidate_order(ecs);
+  return entities;
+}
+
+auto engine::scene::hierarchy_order(architecture::ECS& ecs) -> const HierarchyOrder& {
+  auto* cache = ecs.try_ctx<CachedOrder>();
+  if (cache == nullptr)
+    cache = &ecs.set<CachedOrder>();
+
+  // NOTE: Nodes may also be created or marked static without going through this file, so the pool sizes are compared as well.
+  auto node_count   = ecs.size<component::Node>();
+  auto static_count = ecs.size<component::Static>();
+  if (cache->valid && cache->node_count == node_count && cache->static_count == static_count)
+    return cache->order;
+
+  ecs.sort<component::Node>(
+    [](const component::Node& lhs, const component::Node& rhs) {
+      return lhs.depth < rhs.depth;
+    },
+    [](auto first, auto last, auto compare) {
+      std::stable_sort(first, last, std::move(compare));
+    });
+
+  auto& order = cache->order;
+  order.nodes.clear();
+  order.levels.clear();
+  order.version++;
+
+  auto nodes   = ecs.view<component::Node>();
+  auto statics = ecs.view<component::Static>();
+  order.nodes.reserve(nodes.size());
+  for (auto e : nodes) {
+    if (statics.contains(e))
+      continue;
+
+    auto depth = nodes.get<component::Node>(e).depth;
+    if (order.levels.empty() || nodes.get<component::Node>(order.nodes[order.levels.back()]).depth != depth)
+      order.levels.push_back(order.nodes.size());
+
+    order.nodes.push_back(e);
+  }
+
+  order.static_begin = order.nodes.size();
+  for (auto e : nodes)
+    if (statics.contains(e))
+      order.nodes.push_back(e);
+
+  cache->valid        = true;
+  cache->node_count   = node_count;
+  cache->static_count = static_count;
+  return order;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "component/node.hpp"
+
+#include "../architecture/ecs.hpp"
+
+#include <vector>
+
+namespace engine::scene {
+
+  /// @brief Attaches entity \p child as the last child of entity \p parent.
+  ///
+  /// Both entities must have a component::Node and \p child must not currently have a parent.
+  /// The depths of the whole subtree rooted at \p child are updated accordingly.
+  void attach(architecture::ECS& ecs, architecture::EntityID parent, architecture::EntityID child);
+
+  /// @brief Detaches entity \p child from its parent, making it the root of its own subtree.
+  void detach(architecture::ECS& ecs, architecture::EntityID child);
+
+  /// @brief Returns entity \p root and all of its descendants in depth-first order, visiting children in the order they were attached.
+  auto subtree(const architecture::ECS& ecs, architecture::EntityID root) -> std::vector<architecture::EntityID>;
+
+  /// @brief Detaches entity \p root from its parent and destroys it along with all of its descendants.
+  ///
+  /// All entities are destroyed in a single batch, in reverse depth-first order.
+  /// Since the registry reuses the most recently destroyed IDs first, entities created afterwards recycle the IDs of the subtree in their original order.
+  /// Returns the destroyed entities in depth-first order.
+  auto destroy_subtree(architecture::ECS& ecs, architecture::EntityID root) -> std::vector<architecture::EntityID>;
+
+  /// @brief HierarchyOrder lists all nodes of a hierarchy such that parents come before their children.
+  struct HierarchyOrder {
+    std::vector<architecture::EntityID> nodes; //< Dynamic nodes sorted by depth, followed by static nodes sorted by depth.
+    std::vector<std::size_t> levels;           //< Offsets into nodes where each depth level of the dynamic nodes begins.
+    std::size_t static_begin = 0;              //< Offset into nodes where the static nodes begin.
+    unsigned int version     = 0;              //< Incremented whenever the order changes.
+  };
+
+  /// @brief CachedOrder is stored in the context of the ECS to avoid sorting an unchanged hierarchy, see hierarchy_order().
+  struct CachedOrder {
+    HierarchyOrder order;
+    bool valid               = false;
+    std::size_t node_count   = 0;
+    std::size_t static_count = 0;
+  };
+
+  /// @brief Returns the order of the nodes in the hierarchy stored in \p ecs.
+  ///
+  /// The component::Node pool is sorted to match the order, such that iterating it is cache-friendly.
+  /// The sort is stable, which keeps the order deterministic, and it is only redone when the hierarchy has changed since the last call.
+  auto hierarchy_order(architecture::ECS& ecs) -> const HierarchyOrder&;
+
+  /// @brief Invokes \p func with each child of entity \p parent, in the order they were attached.
+  template <typename F>
+  void for_each_child(const architecture::ECS& ecs, architecture::EntityID parent, F func) {
+    auto child = ecs.get<component::Node>(parent).first_child;
+    while (child != architecture::NullEntityID) {
+      // Fetch the sibling first so that func may detach the child.
+      auto next = ecs.get<component::Node>(child).next_sibling;
+      func(child);
+      child = next;
+    }
+  }
+
+}
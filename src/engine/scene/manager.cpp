@@ -4,31 +4,187 @@
 
 #include "component/root.hpp"
 
+#include "../graphics/component/render_proxies.hpp"
+
+#include <chrono>
+#include <exception>
+
 using namespace engine::scene;
 
 Manager::Manager(const os::InputManager& input_manager,
-                 graphics::Renderer& renderer,
+                 graphics::FrameBuilder& frames,
+                 std::function<void(graphics::RenderSnapshot)> publish,
+                 job::JobSystem& jobs,
+                 time::TaskQueue& tasks,
+                 graphics::AssetLoader& assets,
                  std::vector<std::unique_ptr<IFactory>> scene_factories)
-        : _api(input_manager),
-          _renderer(renderer) {
+        : _api(input_manager, *this, jobs, tasks, assets),
+          _jobs(jobs),
+          _frames(frames),
+          _publish(std::move(publish)) {
 
-  for (auto& scene_factory : scene_factories)
-    _scenes.emplace_back(_api, *scene_factory);
-}
+  _slots.resize(scene_factories.size());
+  for (unsigned int i = 0; i < scene_factories.size(); i++)
+    _slots[i].factory = std::move(scene_factories[i]);
 
-void Manager::update(float delta_time) {
-  for (auto& scene : _scenes)
-    scene.update(delta_time);
+  if (!_slots.empty())
+    load(0);
 }
 
-void Manager::render() {
-  for (auto& scene : _scenes) {
-    if (_api.camera != nullptr) {
-      _renderer.render(scene.ecs(), 0, _api.camera->view_projection());
-      _renderer.render(scene.ecs(), 1, _api.camera->view_projection());
-    }
+void Manager::update(float delta_time, const graphics::Interpolation& interpolation) {
+  finish_loading();
+  update_scenes(delta_time);
+
+  // NOTE: The prepare systems spread each scene across the workers themselves.
+  for (auto& slot : _slots)
+    if (slot.scene != nullptr && slot.scene->is_enabled())
+      _frames.prepare(slot.scene->ecs());
+
+  graphics::RenderSnapshot snapshot;
+  snapshot.interpolation = interpolation;
+  if (_api.camera != nullptr) {
+    // The camera is blended between updates just like the meshes, but a camera that was just set has no previous update to blend from.
+    snapshot.has_camera               = true;
+    snapshot.view_projection          = _api.camera->view_projection();
+    snapshot.previous_view_projection = _api.camera == _previous_camera ? _previous_view_projection : snapshot.view_projection;
+    _previous_view_projection         = snapshot.view_projection;
   }
+  _previous_camera = _api.camera;
+  for (auto& slot : _slots)
+    if (slot.scene != nullptr && slot.scene->is_enabled())
+      _frames.capture(slot.scene->ecs(), snapshot);
+  snapshot.released.insert(snapshot.released.end(), _released.begin(), _released.end());
+  _released.clear();
+  _publish(std::move(snapshot));
+
+  finish_unloading();
 }
 
 void Manager::gui() {
 }
+
+void Manager::load(unsigned int scene_id) {
+  auto& s = slot(scene_id);
+  if (s.scene != nullptr || s.loading.valid())
+    return;
+
+  s.factory->load_assets(_api);
+  s.scene = std::make_unique<Scene>(_api, *s.factory);
+  _frames.prepare(s.scene->ecs());
+}
+
+void Manager::load_async(unsigned int scene_id) {
+  auto& s = slot(scene_id);
+  if (s.scene != nullptr || s.loading.valid())
+    return;
+
+  s.loading = std::async(std::launch::async, [this, factory = s.factory.get()] {
+    factory->load_assets(_api);
+  });
+}
+
+void Manager::unload(unsigned int scene_id) {
+  slot(scene_id).unload_requested = true;
+}
+
+void Manager::set_enabled(unsigned int scene_id, bool enabled) {
+  auto& s = slot(scene_id);
+  if (s.scene == nullptr) {
+    LOG_WARNING("Can't enable or disable scene " + std::to_string(scene_id) + " since it is not loaded.");
+    return;
+  }
+
+  s.scene->set_enabled(enabled);
+}
+
+auto Manager::is_loaded(unsigned int scene_id) const -> bool {
+  return slot(scene_id).scene != nullptr;
+}
+
+auto Manager::scene_count() const -> unsigned int {
+  return _slots.size();
+}
+
+auto Manager::slot(unsigned int scene_id) -> SceneSlot& {
+  if (scene_id >= _slots.size())
+    LOG_ERROR("Scene with ID " + std::to_string(scene_id) + " does not exist.");
+
+  return _slots[scene_id];
+}
+
+auto Manager::slot(unsigned int scene_id) const -> const SceneSlot& {
+  if (scene_id >= _slots.size())
+    LOG_ERROR("Scene with ID " + std::to_string(scene_id) + " does not exist.");
+
+  return _slots[scene_id];
+}
+
+void Manager::update_scenes(float delta_time) {
+  std::vector<Scene*> concurrent;
+  for (auto& slot : _slots)
+    if (slot.scene != nullptr && slot.scene->is_enabled() && slot.scene->is_thread_safe())
+      concurrent.push_back(slot.scene.get());
+
+  std::vector<std::exception_ptr> errors(concurrent.size());
+  job::JobSystem::Counter updates;
+  for (std::size_t i = 0; i < concurrent.size(); i++) {
+    auto update = [scene = concurrent[i], &error = errors[i], delta_time] {
+      try {
+        scene->update(delta_time);
+      } catch (...) {
+        error = std::current_exception();
+      }
+    };
+    _jobs.run(update, updates);
+  }
+
+  // Scripts that aren't thread-safe may touch shared state, so they stay on this thread in scene order.
+  try {
+    for (auto& slot : _slots)
+      if (slot.scene != nullptr && slot.scene->is_enabled() && !slot.scene->is_thread_safe())
+        slot.scene->update(delta_time);
+  } catch (...) {
+    _jobs.wait(updates);
+    throw;
+  }
+
+  _jobs.wait(updates);
+  for (auto& error : errors)
+    if (error != nullptr)
+      std::rethrow_exception(error);
+}
+
+void Manager::finish_loading() {
+  for (auto& s : _slots) {
+    if (!s.loading.valid() || s.loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      continue;
+
+    // Rethrows errors of the background thread.
+    s.loading.get();
+    s.scene = std::make_unique<Scene>(_api, *s.factory);
+    _frames.prepare(s.scene->ecs());
+  }
+}
+
+void Manager::finish_unloading() {
+  for (auto& s : _slots) {
+    if (!s.unload_requested)
+      continue;
+
+    // NOTE: A scene that is still loading has to finish before it can be destroyed.
+    if (s.loading.valid())
+      s.loading.wait();
+
+    // The meshes of the scene only reach the render thread through its ECS, so they are released with the next snapshot.
+    // This also covers disabled scenes, whose mesh changes haven't been captured since they were disabled.
+    if (s.scene != nullptr) {
+      s.scene->clear();
+      if (const auto* updates = s.scene->ecs().try_ctx<graphics::component::MeshUpdates>(); updates != nullptr)
+        _released.insert(_released.end(), updates->released.begin(), updates->released.end());
+    }
+
+    s.loading          = {};
+    s.scene            = nullptr;
+    s.unload_requested = false;
+  }
+}
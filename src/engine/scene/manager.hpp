@@ -6,39 +6,111 @@
 #include "scene.hpp"
 
 #include "../architecture/ecs.hpp"
-#include "../graphics/renderer.hpp"
+#include "../graphics/frame_builder.hpp"
+#include "../graphics/asset_loader.hpp"
+#include "../graphics/render_snapshot.hpp"
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <set>
 #include <vector>
 
 namespace engine::scene {
 
-  /// @brief Manager stores, enables/disables, updates, and renders scenes.
+  /// @brief Manager stores, loads/unloads, enables/disables, updates, and renders scenes.
+  ///
+  /// Every scene factory is registered under a scene ID, which is its index in the list of factories.
+  /// Only registered scenes that are loaded take up memory, and only loaded scenes that are enabled are updated and rendered.
   ///
   /// @todo Give the user their own logger.
-  /// @todo Don't load all scenes at start. Have config and let user decide when they load/unload.
   class Manager {
   public:
+    /// @brief Registers \p scene_factories and loads the scene with ID 0, if there is one.
+    ///
+    /// Every update() hands a snapshot of the scenes to \p publish, e.g. graphics::RenderThread::publish().
     Manager(const os::InputManager& input_manager,
-            graphics::Renderer& renderer,
+            graphics::FrameBuilder& frames,
+            std::function<void(graphics::RenderSnapshot)> publish,
+            job::JobSystem& jobs,
+            time::TaskQueue& tasks,
+            graphics::AssetLoader& assets,
             std::vector<std::unique_ptr<IFactory>> scene_factories);
 
-    /// @brief Updates the physics and game logic of all active scenes.
-    void update(float delta_time);
+    /// @name Mutators
+    /// @{
 
-    /// @brief Renders the models of all active scenes.
-    void render();
+    /// @brief Updates the physics and game logic of all active scenes.
+    ///
+    /// Scenes with a thread-safe script are updated concurrently on the job system, while the other scenes are updated one after another on the calling thread.
+    /// All updates are done before any scene is prepared, and exceptions thrown by concurrent updates are rethrown once they are.
+    /// Then prepares the updated scenes for rendering and publishes a snapshot of them to the render thread, which blends their transforms according to \p interpolation.
+    /// Scenes that finished loading in the background are added first, and requested unloads are done last.
+    void update(float delta_time, const graphics::Interpolation& interpolation);
 
     /// @brief Renders the GUI of all active scenes.
     void gui();
 
+    /// @brief Loads the scene with ID \p scene_id on the calling thread, unless it is already loaded or loading.
+    void load(unsigned int scene_id);
+
+    /// @brief Loads the assets of the scene with ID \p scene_id on a background thread, unless it is already loaded or loading, see IFactory::load_assets().
+    ///
+    /// The scene and its script are created during the first update() after the assets are loaded.
+    /// They are created on the calling thread, since scripts register input callbacks and hand out state through the SceneAPI.
+    void load_async(unsigned int scene_id);
+
+    /// @brief Unloads the scene with ID \p scene_id at the end of the current or next update().
+    ///
+    /// Scripts that hand out state through the SceneAPI, such as the camera, must take it back in their destructor.
+    void unload(unsigned int scene_id);
+
+    /// @brief Pauses or resumes updating and rendering the scene with ID \p scene_id, without unloading it.
+    void set_enabled(unsigned int scene_id, bool enabled);
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Checks if the scene with ID \p scene_id has finished loading.
+    [[nodiscard]] auto is_loaded(unsigned int scene_id) const -> bool;
+
+    /// @brief Returns the number of registered scenes.
+    [[nodiscard]] auto scene_count() const -> unsigned int;
+
+    /// @}
+
   private:
+    /// @brief SceneSlot holds a registered scene and its lifecycle state.
+    struct SceneSlot {
+      std::unique_ptr<IFactory> factory;
+      std::unique_ptr<Scene> scene; //< null while the scene is not loaded
+      std::future<void> loading;    //< valid while the assets of the scene are loading in the background
+      bool unload_requested = false;
+    };
+
+    auto slot(unsigned int scene_id) -> SceneSlot&;
+    auto slot(unsigned int scene_id) const -> const SceneSlot&;
+
+    /// @brief Creates the scenes whose assets finished loading in the background.
+    void finish_loading();
+
+    /// @brief Destroys the scenes whose unload was requested.
+    void finish_unloading();
+
+    /// @brief Updates the scripts of all enabled scenes, and returns once every update is done.
+    void update_scenes(float delta_time);
+
     /// @{
     /// Private state.
-    std::vector<Scene> _scenes;
     SceneAPI _api;
-    graphics::Renderer& _renderer;
+    job::JobSystem& _jobs;
+    graphics::FrameBuilder& _frames;
+    std::function<void(graphics::RenderSnapshot)> _publish;
+    std::vector<SceneSlot> _slots;
+    std::vector<unsigned int> _released; //< meshes of unloaded scenes, which the next snapshot releases
+    const graphics::Camera* _previous_camera = nullptr; //< the camera of the last snapshot
+    geometry::Matrix<4> _previous_view_projection;      //< its view projection in the last snapshot
     /// @}
   };
 
@@ -0,0 +1,148 @@
+#include "name_index.hpp"
+
+#include "component/name.hpp"
+#include "component/node.hpp"
+
+#include "../debug/logger.hpp"
+
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace engine;
+using namespace engine::scene;
+
+namespace {
+
+  using ChildKey = std::pair<architecture::EntityID, std::string>; //< parent and name of a child
+
+  struct ChildKeyHash {
+    auto operator()(const ChildKey& key) const -> std::size_t {
+      auto parent = std::hash<architecture::EntityID>()(key.first);
+      return std::hash<std::string>()(key.second) ^ (parent + 0x9e3779b9 + (parent << 6) + (parent >> 2));
+    }
+  };
+
+  /// Stored in the context of the ECS and kept up to date through the signals of component::Name.
+  struct NameIndex {
+    std::unordered_map<std::string, std::unordered_set<architecture::EntityID>> by_name;
+    std::unordered_map<ChildKey, architecture::EntityID, ChildKeyHash> by_child_name;
+    std::unordered_map<architecture::EntityID, std::string> names;   //< the name each entity is stored under in by_name
+    std::unordered_map<architecture::EntityID, ChildKey> child_keys; //< the key each entity is stored under in by_child_name
+  };
+
+  void remove_child_key(NameIndex& index, architecture::EntityID entity) {
+    auto it = index.child_keys.find(entity);
+    if (it == index.child_keys.end())
+      return;
+
+    index.by_child_name.erase(it->second);
+    index.child_keys.erase(it);
+  }
+
+  void add_child_key(NameIndex& index, architecture::EntityID entity, architecture::EntityID parent, const std::string& name) {
+    if (parent == architecture::NullEntityID)
+      return;
+
+    ChildKey key(parent, name);
+    if (index.by_child_name.count(key) > 0) {
+      LOG_WARNING("Node name \"" + name + "\" is already used by a sibling, so the node can't be found by path.");
+      return;
+    }
+
+    index.by_child_name.emplace(key, entity);
+    index.child_keys.emplace(entity, std::move(key));
+  }
+
+  void remove_name(architecture::ECS& ecs, architecture::EntityID entity) {
+    auto& index = ecs.ctx<NameIndex>();
+
+    // NOTE: The index remembers the old name, since on_update is emitted after the component has already changed.
+    auto it = index.names.find(entity);
+    if (it != index.names.end()) {
+      auto entities = index.by_name.find(it->second);
+      entities->second.erase(entity);
+      if (entities->second.empty())
+        index.by_name.erase(entities);
+      index.names.erase(it);
+    }
+
+    remove_child_key(index, entity);
+  }
+
+  void add_name(architecture::ECS& ecs, architecture::EntityID entity) {
+    auto& index      = ecs.ctx<NameIndex>();
+    const auto& name = ecs.get<component::Name>(entity).name;
+    const auto* node = ecs.try_get<component::Node>(entity);
+
+    index.by_name[name].insert(entity);
+    index.names[entity] = name;
+    add_child_key(index, entity, node != nullptr ? node->parent : architecture::NullEntityID, name);
+  }
+
+  void rename(architecture::ECS& ecs, architecture::EntityID entity) {
+    remove_name(ecs, entity);
+    add_name(ecs, entity);
+  }
+
+  /// Creates the index on first use, after which it is updated incrementally.
+  auto name_index(architecture::ECS& ecs) -> NameIndex& {
+    if (auto* index = ecs.try_ctx<NameIndex>(); index != nullptr)
+      return *index;
+
+    auto& index = ecs.set<NameIndex>();
+    for (auto e : ecs.view<component::Name>())
+      add_name(ecs, e);
+
+    ecs.on_construct<component::Name>().connect<&add_name>();
+    ecs.on_update<component::Name>().connect<&rename>();
+    ecs.on_destroy<component::Name>().connect<&remove_name>();
+    return index;
+  }
+
+}
+
+auto engine::scene::find_by_name(architecture::ECS& ecs, const std::string& name) -> architecture::EntityID {
+  auto& index = name_index(ecs);
+  auto it     = index.by_name.find(name);
+  if (it == index.by_name.end())
+    return architecture::NullEntityID;
+
+  return *it->second.begin();
+}
+
+auto engine::scene::find_by_path(architecture::ECS& ecs, architecture::EntityID from, const std::string& path)
+  -> architecture::EntityID {
+  if (path.empty())
+    return from;
+
+  auto& index  = name_index(ecs);
+  auto current = from;
+
+  std::size_t begin = 0;
+  while (begin <= path.size() && current != architecture::NullEntityID) {
+    auto end = path.find('/', begin);
+    if (end == std::string::npos)
+      end = path.size();
+
+    auto it = index.by_child_name.find(ChildKey(current, path.substr(begin, end - begin)));
+    current = it != index.by_child_name.end() ? it->second : architecture::NullEntityID;
+    begin   = end + 1;
+  }
+
+  return current;
+}
+
+void engine::scene::update_name_index_parent(architecture::ECS& ecs, architecture::EntityID child) {
+  auto* index = ecs.try_ctx<NameIndex>();
+  if (index == nullptr)
+    return;
+
+  const auto* name = ecs.try_get<component::Name>(child);
+  if (name == nullptr)
+    return;
+
+  remove_child_key(*index, child);
+  add_child_key(*index, child, ecs.get<component::Node>(child).parent, name->name);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "../architecture/ecs.hpp"
+
+#include <string>
+
+namespace engine::scene {
+
+  /// @brief Returns an entity whose component::Name is \p name, or NullEntityID if there is none.
+  ///
+  /// If several entities share the name, any one of them may be returned.
+  auto find_by_name(architecture::ECS& ecs, const std::string& name) -> architecture::EntityID;
+
+  /// @brief Returns the descendant of entity \p from at \p path, or NullEntityID if there is none.
+  ///
+  /// The path lists the names of the nodes on the way down from \p from, separated by '/', such as "rubiks_cube/piece_1_2_0".
+  /// Each step is a single hash lookup, so the cost only depends on the length of the path.
+  auto find_by_path(architecture::ECS& ecs, architecture::EntityID from, const std::string& path) -> architecture::EntityID;
+
+  /// @brief Updates the name index of \p ecs after the parent of entity \p child has changed.
+  ///
+  /// Called by attach() and detach(). Does nothing if the name index has not been used yet.
+  void update_name_index_parent(architecture::ECS& ecs, architecture::EntityID child);
+
+}
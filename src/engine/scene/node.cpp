@@ -1,20 +1,123 @@
 #include "node.hpp"
 
+#include "component/name.hpp"
 #include "component/node.hpp"
+#include "component/root.hpp"
+#include "hierarchy.hpp"
+#include "name_index.hpp"
+#include "node_pool.hpp"
 
+#include "../geometry/transform.hpp"
+
+using namespace engine;
 using namespace engine::scene;
 
-Node::Node(architecture::ECS& ecs, architecture::EntityID id)
+static void warn_static_transform_change(architecture::ECS& ecs, architecture::EntityID entity) {
+  if (ecs.has<component::Static>(entity))
+    LOG_WARNING("The transform of a static node was changed. The change will not be visible.");
+}
+
+Node::Node(architecture::ECS& ecs, NodePool& pool, architecture::EntityID id)
         : _ecs(ecs),
+          _pool(pool),
           _id(id) {}
 
 auto Node::add_child() -> Node& {
+  warn_if_static();
+
   // ECS side
   auto ecs_child = _ecs.get().create();
-  _ecs.get().emplace<component::Node>(ecs_child, _id);
-  _ecs.get().get<component::Node>(_id).children.insert(ecs_child);
+  _ecs.get().emplace<component::Node>(ecs_child);
+  attach(_ecs.get(), _id, ecs_child);
 
   // OOP side
-  _children.push_back(std::make_unique<Node>(_ecs.get(), ecs_child));
-  return *_children.back();
+  return _pool.get().create(_ecs.get(), ecs_child);
+}
+
+auto Node::instantiate(const Prefab& prefab, std::size_t count) -> std::vector<std::experimental::observer_ptr<Node>> {
+  warn_if_static();
+
+  auto roots = prefab.instantiate(_ecs.get(), _id, count);
+
+  auto& pool = _pool.get();
+  pool.reserve(pool.size() + roots.size());
+
+  std::vector<std::experimental::observer_ptr<Node>> nodes;
+  nodes.reserve(roots.size());
+  for (auto root : roots)
+    nodes.push_back(std::experimental::make_observer(&pool.create(_ecs.get(), root)));
+  return nodes;
+}
+
+void Node::set_name(const std::string& name) {
+  _ecs.get().emplace_or_replace<component::Name>(_id, name);
+}
+
+auto Node::find(const std::string& path) -> std::experimental::observer_ptr<Node> {
+  auto entity = find_by_path(_ecs.get(), _id, path);
+  if (entity == architecture::NullEntityID)
+    return nullptr;
+
+  // NOTE: Entities created in bulk, such as by prefabs, only get a Node object once they are looked up.
+  auto* node = _pool.get().find(entity);
+  if (node == nullptr)
+    node = &_pool.get().create(_ecs.get(), entity);
+  return std::experimental::make_observer(node);
+}
+
+void Node::destroy() {
+  auto& ecs = _ecs.get();
+  if (ecs.has<component::Root>(_id))
+    LOG_ERROR("The root node of a scene can't be destroyed.");
+
+  // NOTE: Releasing this node ends its lifetime, so nothing may access members afterwards.
+  auto& pool = _pool.get();
+  for (auto e : destroy_subtree(ecs, _id))
+    pool.release(e);
+}
+
+void Node::make_static() {
+  auto& ecs = _ecs.get();
+
+  auto parent = ecs.get<component::Node>(_id).parent;
+  if (parent != architecture::NullEntityID && !ecs.has<component::Static>(parent) && !ecs.has<component::Root>(parent))
+    LOG_WARNING("A static node was added below a dynamic node. It will not follow its parent.");
+
+  // Catch changes made directly through the ECS rather than through Node.
+  ecs.on_construct<geometry::Transform>().connect<&warn_static_transform_change>();
+  ecs.on_update<geometry::Transform>().connect<&warn_static_transform_change>();
+
+  for (auto e : subtree(ecs, _id))
+    ecs.emplace_or_replace<component::Static>(e);
+}
+
+auto Node::routines() -> RoutineScheduler& {
+  auto& ecs      = _ecs.get();
+  auto* routines = ecs.try_ctx<RoutineScheduler>();
+  return routines != nullptr ? *routines : ecs.set<RoutineScheduler>();
+}
+
+auto Node::reattach(Node& parent) -> Node& {
+  // NOTE: A node below itself would make its parents a cycle, which every walk up or down the hierarchy would follow forever.
+  for (auto e = parent._id; e != architecture::NullEntityID; e = _ecs.get().get<component::Node>(e).parent)
+    if (e == _id)
+      LOG_ERROR("Can't move a node below itself or one of its descendants.");
+
+  detach(_ecs.get(), _id);
+  attach(_ecs.get(), parent._id, _id);
+  return *this;
+}
+
+auto Node::adopt_migrated(Node& parent, architecture::EntityID root, const std::vector<architecture::EntityID>& entities) -> Node& {
+  // NOTE: Releasing this node ends its lifetime, so nothing may access members afterwards.
+  auto& pool = _pool.get();
+  for (auto e : entities)
+    pool.release(e);
+
+  return parent._pool.get().create(parent._ecs.get(), root);
+}
+
+void Node::warn_if_static() const {
+  if (_ecs.get().has<component::Static>(_id))
+    LOG_WARNING("A static node was changed. The change may not be visible.");
 }
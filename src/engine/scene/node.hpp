@@ -2,38 +2,112 @@
 
 #include "../architecture/ecs.hpp"
 #include "../debug/logger.hpp"
+#include "component/static.hpp"
+#include "prefab.hpp"
+#include "routine.hpp"
 
+#include <experimental/memory>
+#include <string>
 #include <vector>
 
 namespace engine::scene {
 
+  class NodePool;
+
   /// @brief Node acts is if we use a normal scene graph to the user.
   ///
   /// This is the class that the user interacts with.
   /// @todo Maybe create an interface to hide includes and constructor from the user.
   /// @todo Don't allow access to parent node when node is root.
-  /// @todo Consider adding a "name" field for to_json conversion of scene hierarchy.
   /// @todo Replace "ecs" with an interface that provides basic node operations, not a mutable reference to whole ECS world.
   class Node {
   public:
-    Node(architecture::ECS& ecs, architecture::EntityID id);
+    Node(architecture::ECS& ecs, NodePool& pool, architecture::EntityID id);
 
     auto add_child() -> Node&;
 
+    /// @brief Names this node, such that it can be found with find().
+    void set_name(const std::string& name);
+
+    /// @brief Returns the descendant of this node at \p path, or nullptr if there is none.
+    ///
+    /// The path lists the names of the nodes on the way down, separated by '/', such as "rubiks_cube/piece_1_2_0".
+    auto find(const std::string& path) -> std::experimental::observer_ptr<Node>;
+
+    /// @brief Moves this node and all of its descendants below \p parent, which may be part of another scene.
+    ///
+    /// Within a scene the nodes are simply reattached. Between scenes, the subtree is migrated along with its components of type \p Components, see migrate().
+    /// In that case this node and all Node objects of the subtree are released, so they must not be used afterwards, and the new node is returned instead.
+    template <typename... Components>
+    auto move_to(Node& parent) -> Node& {
+      if (&parent._ecs.get() == &_ecs.get())
+        return reattach(parent);
+
+      auto entities = subtree(_ecs.get(), _id);
+      auto root     = migrate<Components...>(_ecs.get(), _id, parent._ecs.get(), parent._id);
+      return adopt_migrated(parent, root, entities);
+    }
+
+    /// @brief Destroys this node and all of its descendants, including their entities and components.
+    ///
+    /// This node and all Node objects of the subtree are released, so they must not be used afterwards.
+    void destroy();
+
+    /// @brief Marks this node and all of its descendants as static.
+    ///
+    /// The global transforms of static nodes are computed once and then skipped by all per-frame transform work.
+    /// Static nodes are not meant to change afterwards, so doing so produces a warning.
+    void make_static();
+
+    /// @brief Captures the subtree rooted at this node as a prefab, including the components of type \p Components.
+    template <typename... Components>
+    auto to_prefab() const -> Prefab {
+      return Prefab::capture<Components...>(_ecs.get(), _id);
+    }
+
+    /// @brief Adds \p count copies of \p prefab as children of this node and returns the roots of the copies.
+    auto instantiate(const Prefab& prefab, std::size_t count) -> std::vector<std::experimental::observer_ptr<Node>>;
+
+    /// @brief Returns the routines of the scene this node belongs to, which are resumed after each update of its script.
+    auto routines() -> RoutineScheduler&;
+
     template <typename T, typename... Args>
     void add_component(Args&&... args) {
+      warn_if_static();
       _ecs.get().emplace<T>(_id, std::forward<Args>(args)...);
     }
 
+    /// @brief Returns the component of type \p T of this node.
+    ///
+    /// Changes through the returned reference are neither warned about on static nodes nor seen by architecture::ComponentChanges, see patch().
     template <typename T>
     auto component() -> T& {
       return _ecs.get().get<T>(_id);
     }
 
+    /// @brief Changes the component of type \p T of this node by calling \p func with it, and notifies the observers of the change.
+    template <typename T, typename F>
+    void patch(F&& func) {
+      warn_if_static();
+      _ecs.get().patch<T>(_id, std::forward<F>(func));
+    }
+
+    template <typename T>
+    auto component() const -> const T& {
+      return _ecs.get().get<T>(_id);
+    }
+
   private:
+    void warn_if_static() const;
+
+    auto reattach(Node& parent) -> Node&;
+
+    /// @brief Releases the Node objects of the migrated \p entities and returns a new Node for \p root, which now lives below \p parent.
+    auto adopt_migrated(Node& parent, architecture::EntityID root, const std::vector<architecture::EntityID>& entities) -> Node&;
+
     std::reference_wrapper<architecture::ECS> _ecs;
-    architecture::EntityID _id;                   //< the entity that this OOP object wraps
-    std::vector<std::unique_ptr<Node>> _children; // NOTE: Careful, this is duplicated data since component::Node already stores the hierarchy of the nodes. However, Node objects need to be managed and stored in static memory somehow so this is a good enough trade-off to bridge the engine's ECS and the user's OOP world.
+    std::reference_wrapper<NodePool> _pool; //< owns this node and all other nodes of the scene
+    architecture::EntityID _id;             //< the entity that this OOP object wraps
   };
 
 }
@@ -0,0 +1,59 @@
+#include "node_pool.hpp"
+
+#include <new>
+
+using namespace engine::scene;
+
+NodePool::~NodePool() {
+  for (auto [id, slot] : _slots)
+    at(slot)->~Node();
+}
+
+auto NodePool::create(architecture::ECS& ecs, architecture::EntityID id) -> Node& {
+  std::size_t slot = _end;
+  if (!_free.empty()) {
+    slot = _free.back();
+    _free.pop_back();
+  } else {
+    allocate_chunks(++_end);
+  }
+
+  auto* node = new (at(slot)) Node(ecs, *this, id);
+  _slots[id] = slot;
+  return *node;
+}
+
+void NodePool::release(architecture::EntityID id) {
+  auto it = _slots.find(id);
+  if (it == _slots.end())
+    return;
+
+  at(it->second)->~Node();
+  _free.push_back(it->second);
+  _slots.erase(it);
+}
+
+void NodePool::reserve(std::size_t count) {
+  if (count <= size() + _free.size())
+    return;
+
+  allocate_chunks(_end + count - size() - _free.size());
+}
+
+void NodePool::allocate_chunks(std::size_t end) {
+  while (_chunks.size() * chunk_size < end)
+    _chunks.push_back(std::make_unique<Storage[]>(chunk_size)); // NOLINT(cppcoreguidelines-avoid-c-arrays)
+}
+
+auto NodePool::find(architecture::EntityID id) -> Node* {
+  auto it = _slots.find(id);
+  return it != _slots.end() ? at(it->second) : nullptr;
+}
+
+auto NodePool::size() const -> std::size_t {
+  return _slots.size();
+}
+
+auto NodePool::at(std::size_t index) -> Node* {
+  return std::launder(reinterpret_cast<Node*>(&_chunks[index / chunk_size][index % chunk_size])); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
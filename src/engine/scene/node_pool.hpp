@@ -0,0 +1,68 @@
+#pragma once
+
+#include "node.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::scene {
+
+  /// @brief NodePool allocates the Node objects of a scene in fixed-size chunks.
+  ///
+  /// Nodes never move once created, so references to them stay valid until they are released or the pool is destroyed.
+  /// Released slots are reused by later nodes, most recently released first.
+  /// The pool can't be copied or moved, since every node refers back to the pool that owns it.
+  class NodePool {
+  public:
+    static constexpr std::size_t chunk_size = 256; //< number of nodes per allocation
+
+    NodePool() = default;
+    NodePool(const NodePool&) = delete;
+    NodePool(NodePool&&)      = delete;
+    ~NodePool();
+
+    auto operator=(const NodePool&) -> NodePool& = delete;
+    auto operator=(NodePool&&) -> NodePool& = delete;
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Creates a new node that wraps the entity \p id of \p ecs.
+    auto create(architecture::ECS& ecs, architecture::EntityID id) -> Node&;
+
+    /// @brief Destroys the node that wraps entity \p id, if there is one, and makes its slot available again.
+    void release(architecture::EntityID id);
+
+    /// @brief Allocates enough chunks to hold \p count live nodes in total without further allocations.
+    void reserve(std::size_t count);
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Returns the node that wraps entity \p id, or nullptr if there is none.
+    auto find(architecture::EntityID id) -> Node*;
+
+    /// @brief Returns the number of live nodes.
+    auto size() const -> std::size_t;
+
+    /// @}
+
+  private:
+    using Storage = std::aligned_storage_t<sizeof(Node), alignof(Node)>;
+
+    auto at(std::size_t index) -> Node*;
+
+    /// @brief Allocates chunks until slots [0, \p end) are available.
+    void allocate_chunks(std::size_t end);
+
+    std::vector<std::unique_ptr<Storage[]>> _chunks;                  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    std::unordered_map<architecture::EntityID, std::size_t> _slots; //< the slot of the node that wraps each entity
+    std::vector<std::size_t> _free;                                   //< released slots below _end
+    std::size_t _end = 0;                                             //< one past the highest slot ever used
+  };
+
+}
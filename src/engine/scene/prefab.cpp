@@ -0,0 +1,84 @@
+#include "prefab.hpp"
+
+#include <unordered_map>
+
+using namespace engine::scene;
+
+auto Prefab::instantiate(architecture::ECS& ecs, architecture::EntityID parent, std::size_t count) const
+  -> std::vector<architecture::EntityID> {
+  auto prefab_size = _links.size();
+  if (prefab_size == 0 || count == 0)
+    return {};
+
+  std::vector<architecture::EntityID> entities(count * prefab_size);
+  ecs.create(entities.begin(), entities.end());
+
+  // Translate the prefab indices into the entities of each copy.
+  std::vector<component::Node> nodes;
+  nodes.reserve(entities.size());
+  for (std::size_t copy = 0; copy < count; copy++) {
+    auto* copy_entities = &entities[copy * prefab_size];
+    auto entity_of      = [&](std::size_t index) {
+      return index == npos ? architecture::NullEntityID : copy_entities[index];
+    };
+
+    for (const auto& links : _links) {
+      nodes.push_back(component::Node{
+        .parent       = entity_of(links.parent),
+        .first_child  = entity_of(links.first_child),
+        .last_child   = entity_of(links.last_child),
+        .prev_sibling = entity_of(links.prev_sibling),
+        .next_sibling = entity_of(links.next_sibling),
+        .child_count  = links.child_count,
+        .depth        = links.depth,
+      });
+    }
+  }
+
+  ecs.reserve<component::Node>(ecs.size<component::Node>() + entities.size());
+  ecs.insert<component::Node>(entities.begin(), entities.end(), nodes.begin(), nodes.end());
+
+  for (const auto& storage : _storages)
+    storage->instantiate(ecs, entities, prefab_size);
+
+  std::vector<architecture::EntityID> roots;
+  roots.reserve(count);
+  for (std::size_t copy = 0; copy < count; copy++) {
+    auto root = entities[copy * prefab_size];
+    attach(ecs, parent, root);
+    roots.push_back(root);
+  }
+
+  return roots;
+}
+
+void Prefab::capture_hierarchy(const architecture::ECS& ecs,
+                               architecture::EntityID root,
+                               const std::vector<architecture::EntityID>& entities) {
+  std::unordered_map<architecture::EntityID, std::size_t> indices;
+  for (std::size_t i = 0; i < entities.size(); i++)
+    indices[entities[i]] = i;
+
+  auto index_of = [&](architecture::EntityID e) {
+    return e == architecture::NullEntityID ? npos : indices.at(e);
+  };
+
+  auto root_depth = ecs.get<component::Node>(root).depth;
+  _links.reserve(entities.size());
+  for (auto e : entities) {
+    const auto& node = ecs.get<component::Node>(e);
+    _links.push_back(Links{
+      .parent       = e == root ? npos : index_of(node.parent),
+      .first_child  = index_of(node.first_child),
+      .last_child   = index_of(node.last_child),
+      .prev_sibling = e == root ? npos : index_of(node.prev_sibling),
+      .next_sibling = e == root ? npos : index_of(node.next_sibling),
+      .child_count  = node.child_count,
+      .depth        = node.depth - root_depth,
+    });
+  }
+}
+
+auto Prefab::size() const -> std::size_t {
+  return _links.size();
+}
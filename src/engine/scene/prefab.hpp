@@ -0,0 +1,163 @@
+#pragma once
+
+#include "component/node.hpp"
+#include "hierarchy.hpp"
+
+#include "../architecture/ecs.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace engine::scene {
+
+  /// @brief Prefab is a copy of a subtree of a scene hierarchy that can be instantiated many times.
+  ///
+  /// Only the component types listed on capture() or extract() are copied, along with the hierarchy itself.
+  /// Instantiating creates all entities and components of all copies in bulk.
+  class Prefab {
+  public:
+    /// @brief Captures the subtree of \p ecs rooted at entity \p root, including the components of type \p Components.
+    template <typename... Components>
+    static auto capture(const architecture::ECS& ecs, architecture::EntityID root) -> Prefab;
+
+    /// @brief Like capture(), but moves the components out of \p ecs instead of copying them.
+    ///
+    /// The components left behind are reset to their default value, such that destroying them doesn't release resources that now belong to the prefab, such as GPU buffers.
+    /// The subtree itself is left in place, so it is usually destroyed right after.
+    template <typename... Components>
+    static auto extract(architecture::ECS& ecs, architecture::EntityID root) -> Prefab;
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Creates \p count copies of the prefab and attaches their roots as children of entity \p parent.
+    ///
+    /// Returns the roots of the copies.
+    auto instantiate(architecture::ECS& ecs, architecture::EntityID parent, std::size_t count) const
+      -> std::vector<architecture::EntityID>;
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Returns the number of entities in one copy of the prefab.
+    auto size() const -> std::size_t;
+
+    /// @}
+
+  private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// @brief Links stores the hierarchy of one entity as indices into the prefab.
+    struct Links {
+      std::size_t parent       = npos;
+      std::size_t first_child  = npos;
+      std::size_t last_child   = npos;
+      std::size_t prev_sibling = npos;
+      std::size_t next_sibling = npos;
+      unsigned int child_count = 0;
+      unsigned int depth       = 0; //< Distance to the root of the prefab.
+    };
+
+    // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+    struct IStorage {
+      virtual ~IStorage() = default;
+
+      /// @brief Adds the stored components to \p entities, which holds the entities of all copies one copy after another.
+      virtual void instantiate(architecture::ECS& ecs, const std::vector<architecture::EntityID>& entities, std::size_t prefab_size) const = 0;
+    };
+
+    template <typename T>
+    struct Storage : public IStorage {
+      std::vector<std::size_t> indices; //< the prefab entities that have a component of type T
+      std::vector<T> components;        //< the components of those entities, in the same order
+
+      void instantiate(architecture::ECS& ecs, const std::vector<architecture::EntityID>& entities, std::size_t prefab_size) const override;
+    };
+
+    /// @brief Stores the hierarchy of \p entities, the subtree rooted at \p root in depth-first order.
+    void capture_hierarchy(const architecture::ECS& ecs, architecture::EntityID root, const std::vector<architecture::EntityID>& entities);
+
+    /// @brief Stores the components of type T of \p entities, moving them out of \p ecs if it isn't const.
+    template <typename T, typename Registry>
+    void capture_components(Registry& ecs, const std::vector<architecture::EntityID>& entities);
+
+    std::vector<Links> _links; //< in depth-first order, so the root comes first
+    std::vector<std::unique_ptr<IStorage>> _storages;
+  };
+
+  /// @brief Moves the subtree of \p from rooted at entity \p root into \p to, attaching it as a child of entity \p parent.
+  ///
+  /// The entities get new IDs in \p to, and only the components of type \p Components are moved along.
+  /// Returns the new root of the subtree.
+  template <typename... Components>
+  auto migrate(architecture::ECS& from, architecture::EntityID root, architecture::ECS& to, architecture::EntityID parent)
+    -> architecture::EntityID {
+    auto prefab = Prefab::extract<Components...>(from, root);
+    destroy_subtree(from, root);
+    return prefab.instantiate(to, parent, 1).front();
+  }
+
+  template <typename... Components>
+  auto Prefab::capture(const architecture::ECS& ecs, architecture::EntityID root) -> Prefab {
+    Prefab prefab;
+    auto entities = subtree(ecs, root);
+    prefab.capture_hierarchy(ecs, root, entities);
+    (prefab.capture_components<Components>(ecs, entities), ...);
+    return prefab;
+  }
+
+  template <typename... Components>
+  auto Prefab::extract(architecture::ECS& ecs, architecture::EntityID root) -> Prefab {
+    Prefab prefab;
+    auto entities = subtree(ecs, root);
+    prefab.capture_hierarchy(ecs, root, entities);
+    (prefab.capture_components<Components>(ecs, entities), ...);
+    return prefab;
+  }
+
+  template <typename T, typename Registry>
+  void Prefab::capture_components(Registry& ecs, const std::vector<architecture::EntityID>& entities) {
+    auto storage = std::make_unique<Storage<T>>();
+    for (std::size_t i = 0; i < entities.size(); i++) {
+      if (!ecs.template has<T>(entities[i]))
+        continue;
+
+      storage->indices.push_back(i);
+      if constexpr (std::is_const_v<Registry>) {
+        storage->components.push_back(ecs.template get<T>(entities[i]));
+      } else {
+        // NOTE: Assigning through the reference doesn't emit on_update, so no listener sees the reset.
+        auto& component = ecs.template get<T>(entities[i]);
+        storage->components.push_back(std::move(component));
+        component = T();
+      }
+    }
+
+    if (!storage->indices.empty())
+      _storages.push_back(std::move(storage));
+  }
+
+  template <typename T>
+  void Prefab::Storage<T>::instantiate(architecture::ECS& ecs,
+                                       const std::vector<architecture::EntityID>& entities,
+                                       std::size_t prefab_size) const {
+    auto count = entities.size() / prefab_size;
+
+    std::vector<architecture::EntityID> targets;
+    std::vector<T> copies;
+    targets.reserve(count * indices.size());
+    copies.reserve(count * indices.size());
+    for (std::size_t copy = 0; copy < count; copy++) {
+      for (auto index : indices)
+        targets.push_back(entities[copy * prefab_size + index]);
+      copies.insert(copies.end(), components.begin(), components.end());
+    }
+
+    ecs.reserve<T>(ecs.size<T>() + targets.size());
+    ecs.insert<T>(targets.begin(), targets.end(), copies.begin(), copies.end());
+  }
+
+}
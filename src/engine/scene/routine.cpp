@@ -0,0 +1,90 @@
+#include "routine.hpp"
+
+#include <algorithm>
+
+using namespace engine::scene;
+
+namespace {
+
+  /// @brief Orders sleepers such that the heap keeps the earliest wake-up time at its front.
+  template <typename Sleeper>
+  auto wakes_later(const Sleeper& a, const Sleeper& b) -> bool {
+    if (a.wake_time != b.wake_time)
+      return a.wake_time > b.wake_time;
+    return a.order > b.order;
+  }
+
+}
+
+Wait::Wait(Kind kind, float duration, std::function<bool()> predicate)
+        : _kind(kind),
+          _duration(duration),
+          _predicate(std::move(predicate)) {}
+
+auto Wait::next_tick() -> Wait {
+  return Wait(Kind::NEXT_TICK, 0.0F, nullptr);
+}
+
+auto Wait::seconds(float duration) -> Wait {
+  return Wait(Kind::SECONDS, duration, nullptr);
+}
+
+auto Wait::until(std::function<bool()> predicate) -> Wait {
+  return Wait(Kind::UNTIL, 0.0F, std::move(predicate));
+}
+
+auto Wait::done() -> Wait {
+  return Wait(Kind::DONE, 0.0F, nullptr);
+}
+
+void RoutineScheduler::start(Routine routine) {
+  auto wait = routine();
+  schedule(std::move(routine), std::move(wait));
+}
+
+void RoutineScheduler::update(float delta_time) {
+  _time += delta_time;
+
+  // Everything that is due is collected first, so that rescheduled routines can't be resumed twice.
+  std::vector<Routine> due;
+  due.swap(_ticking);
+
+  while (!_sleepers.empty() && _sleepers.front().wake_time <= _time) {
+    std::pop_heap(_sleepers.begin(), _sleepers.end(), wakes_later<Sleeper>);
+    due.push_back(std::move(_sleepers.back().routine));
+    _sleepers.pop_back();
+  }
+
+  auto waiting_end = std::stable_partition(_waiting.begin(), _waiting.end(), [](auto& waiting) {
+    return !waiting.first();
+  });
+  for (auto it = waiting_end; it != _waiting.end(); ++it)
+    due.push_back(std::move(it->second));
+  _waiting.erase(waiting_end, _waiting.end());
+
+  for (auto& routine : due) {
+    auto wait = routine();
+    schedule(std::move(routine), std::move(wait));
+  }
+}
+
+auto RoutineScheduler::size() const -> std::size_t {
+  return _sleepers.size() + _ticking.size() + _waiting.size();
+}
+
+void RoutineScheduler::schedule(Routine routine, Wait wait) {
+  switch (wait._kind) {
+  case Wait::Kind::NEXT_TICK:
+    _ticking.push_back(std::move(routine));
+    break;
+  case Wait::Kind::SECONDS:
+    _sleepers.push_back({_time + wait._duration, _sleeps++, std::move(routine)});
+    std::push_heap(_sleepers.begin(), _sleepers.end(), wakes_later<Sleeper>);
+    break;
+  case Wait::Kind::UNTIL:
+    _waiting.emplace_back(std::move(wait._predicate), std::move(routine));
+    break;
+  case Wait::Kind::DONE:
+    break;
+  }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace engine::scene {
+
+  /// @brief Wait tells the RoutineScheduler when to resume a routine next.
+  class Wait {
+  public:
+    /// @brief Resumes the routine during the next update.
+    static auto next_tick() -> Wait;
+
+    /// @brief Resumes the routine during the first update once \p duration seconds of scene time have passed.
+    static auto seconds(float duration) -> Wait;
+
+    /// @brief Resumes the routine during the first update in which \p predicate returns true.
+    ///
+    /// The predicate is checked once per update, so it should be cheap.
+    static auto until(std::function<bool()> predicate) -> Wait;
+
+    /// @brief Ends the routine.
+    static auto done() -> Wait;
+
+  private:
+    friend class RoutineScheduler;
+
+    enum class Kind {
+      NEXT_TICK,
+      SECONDS,
+      UNTIL,
+      DONE
+    };
+
+    Wait(Kind kind, float duration, std::function<bool()> predicate);
+
+    /// @{
+    /// Private state.
+    Kind _kind;
+    float _duration;
+    std::function<bool()> _predicate;
+    /// @}
+  };
+
+  /// @brief A routine is a script behaviour that spans several updates.
+  ///
+  /// Each call resumes the routine, which keeps its progress in its captures and returns what it waits for until the next call.
+  using Routine = std::function<Wait()>;
+
+  /// @brief RoutineScheduler resumes the routines of a scene once their waits are over.
+  ///
+  /// Routines that sleep for some seconds are kept in a heap ordered by their wake-up time, and routines that wait for the next tick in a list.
+  /// Updates thus only touch the routines that are resumed, except for routines that wait until a predicate holds, whose predicates are checked every update.
+  class RoutineScheduler {
+  public:
+    /// @name Mutators
+    /// @{
+
+    /// @brief Runs \p routine right away, and resumes it according to the Wait it returns.
+    void start(Routine routine);
+
+    /// @brief Advances the scene time by \p delta_time seconds, and resumes all routines whose waits are over.
+    ///
+    /// Routines that are started or resumed during the update wait for a later update, even if their wait is already over.
+    void update(float delta_time);
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    /// @brief Returns the number of routines that haven't finished yet.
+    [[nodiscard]] auto size() const -> std::size_t;
+
+    /// @}
+
+  private:
+    struct Sleeper {
+      double wake_time;
+      std::uint64_t order; //< keeps routines that wake up at the same time in the order they went to sleep
+      Routine routine;
+    };
+
+    /// @brief Files \p routine under the condition of \p wait.
+    void schedule(Routine routine, Wait wait);
+
+    /// @{
+    /// Private state.
+    double _time          = 0.0;
+    std::uint64_t _sleeps = 0;
+    std::vector<Sleeper> _sleepers; //< min-heap on the wake-up time
+    std::vector<Routine> _ticking;
+    std::vector<std::pair<std::function<bool()>, Routine>> _waiting;
+    /// @}
+  };
+
+}
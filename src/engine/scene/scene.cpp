@@ -6,18 +6,39 @@
 using namespace engine::scene;
 
 Scene::Scene(SceneAPI& api, IFactory& script_factory) {
+  _ecs.set<RoutineScheduler>();
+
   architecture::EntityID root_id = _ecs.create();
   _ecs.emplace<component::Root>(root_id);
   _ecs.emplace<component::Node>(root_id);
 
-  _root   = std::make_unique<Node>(_ecs, root_id);
+  _root   = std::experimental::make_observer(&_nodes.create(_ecs, root_id));
   _script = script_factory.create(api, *_root);
 }
 
 void Scene::update(float delta_time) {
   _script->update(delta_time);
+  _ecs.ctx<RoutineScheduler>().update(delta_time);
+}
+
+void Scene::clear() {
+  // NOTE: Scripts go first, since they may still use their nodes while they are destroyed.
+  _script = nullptr;
+  _ecs.clear();
+}
+
+void Scene::set_enabled(bool enabled) {
+  _enabled = enabled;
 }
 
 auto Scene::ecs() -> architecture::ECS& {
   return _ecs;
 }
+
+auto Scene::is_enabled() const -> bool {
+  return _enabled;
+}
+
+auto Scene::is_thread_safe() const -> bool {
+  return _script->is_thread_safe();
+}
@@ -3,24 +3,50 @@
 #include "api.hpp"
 #include "factory.hpp"
 #include "node.hpp"
+#include "node_pool.hpp"
 #include "script.hpp"
 
 #include "../architecture/ecs.hpp"
 
+#include <experimental/memory>
+
 namespace engine::scene {
 
   /// Scenes are completely separate from one another but objects may be moved between scenes.
+  ///
+  /// Nodes and scripts refer to the members of their scene, so a scene never moves once it is created.
   class Scene {
   public:
     Scene(SceneAPI& api, IFactory& script_factory);
+    Scene(const Scene&) = delete;
+    Scene(Scene&&)      = delete;
+    ~Scene()            = default;
+
+    auto operator=(const Scene&) -> Scene& = delete;
+    auto operator=(Scene&&) -> Scene& = delete;
 
+    /// @brief Updates the script, and then resumes the routines whose waits are over, see Node::routines().
     void update(float delta_time);
 
+    /// @brief Destroys the script and then all entities of the scene, so that their destroy hooks still see the ECS, e.g. to release meshes.
+    ///
+    /// The scene can only be destroyed afterwards.
+    void clear();
+
+    /// @brief Pauses or resumes the scene. Disabled scenes are neither updated nor rendered.
+    void set_enabled(bool enabled);
+
     auto ecs() -> architecture::ECS&;
 
+    [[nodiscard]] auto is_enabled() const -> bool;
+
+    /// @brief Checks if the script of the scene may be updated concurrently with other scenes, see IScript::is_thread_safe().
+    [[nodiscard]] auto is_thread_safe() const -> bool;
+
   private:
     architecture::ECS _ecs;
-    std::unique_ptr<Node> _root;
+    NodePool _nodes;
+    std::experimental::observer_ptr<Node> _root;
     std::unique_ptr<IScript> _script;
     bool _enabled = true;
   };
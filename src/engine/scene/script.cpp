@@ -6,3 +6,7 @@ IScript::IScript() = default;
 
 IScript::IScript([[maybe_unused]] SceneAPI& api,
                  [[maybe_unused]] Node& root) {}
+
+auto IScript::is_thread_safe() const -> bool {
+  return false;
+}
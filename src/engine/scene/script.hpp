@@ -12,6 +12,12 @@ namespace engine::scene {
     IScript(SceneAPI& api, Node& root);
 
     virtual void update(float delta_time) = 0;
+
+    /// @brief Checks if update() may run on a worker thread, concurrently with the updates of other scenes.
+    ///
+    /// Thread-safe scripts may only touch their own scene, and must not use the scene manager or the camera of the SceneAPI.
+    /// Scripts are not thread-safe unless they override this.
+    [[nodiscard]] virtual auto is_thread_safe() const -> bool;
   };
 
 }
@@ -0,0 +1,66 @@
+#include "task_queue.hpp"
+
+#include "../debug/logger.hpp"
+
+using namespace engine::time;
+
+TaskQueue::TaskQueue(std::chrono::nanoseconds budget)
+        : _budget(budget) {}
+
+void TaskQueue::push(std::string name, std::function<bool()> step) {
+  const std::lock_guard<std::mutex> lock(_push_mutex);
+  _pushed.push_back({std::move(name), std::move(step)});
+}
+
+void TaskQueue::run() {
+  {
+    const std::lock_guard<std::mutex> lock(_push_mutex);
+    for (auto& task : _pushed)
+      _tasks.push_back(std::move(task));
+    _pushed.clear();
+  }
+
+  auto start   = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::nanoseconds::zero();
+
+  while (!_tasks.empty()) {
+    auto& task = _tasks.front();
+    bool done  = task.step();
+    elapsed    = std::chrono::steady_clock::now() - start;
+
+    if (elapsed > _budget) {
+      _overruns++;
+      LOG_WARNING("Task \"" + task.name + "\" exceeded the frame budget of " + std::to_string(std::chrono::duration<double, std::milli>(_budget).count()) +
+                  " ms by " + std::to_string(std::chrono::duration<double, std::milli>(elapsed - _budget).count()) + " ms. Consider splitting it into smaller steps.");
+    }
+
+    if (done)
+      _tasks.pop_front();
+
+    if (elapsed >= _budget)
+      break;
+  }
+
+  _last_run_time = elapsed;
+}
+
+void TaskQueue::set_budget(std::chrono::nanoseconds budget) {
+  _budget = budget;
+}
+
+auto TaskQueue::budget() const -> std::chrono::nanoseconds {
+  return _budget;
+}
+
+auto TaskQueue::size() const -> std::size_t {
+  const std::lock_guard<std::mutex> lock(_push_mutex);
+  return _tasks.size() + _pushed.size();
+}
+
+auto TaskQueue::last_run_time() const -> std::chrono::nanoseconds {
+  return _last_run_time;
+}
+
+auto TaskQueue::overruns() const -> unsigned int {
+  return _overruns;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace engine::time {
+
+  /// @brief TaskQueue spreads expensive work, such as rebuilding acceleration structures or generating meshes, over several frames.
+  ///
+  /// A task is split into steps by the caller. Every call to its step function does a small slice of the work and returns whether the task is done.
+  /// Each run() executes steps, oldest task first, until the time budget of the frame is spent, and continues where it left off during the next run().
+  class TaskQueue {
+  public:
+    /// @brief Creates a queue that spends up to \p budget per run().
+    TaskQueue(std::chrono::nanoseconds budget);
+
+    /// @name Mutators
+    /// @{
+
+    /// @brief Adds a task named \p name, which calls \p step until it returns true. Can be called from any thread.
+    void push(std::string name, std::function<bool()> step);
+
+    /// @brief Runs steps of the pending tasks until the budget is spent or no task is left.
+    ///
+    /// At least one step runs per call, so that every task makes progress even if a single step exceeds the budget.
+    /// A run that exceeds the budget is counted as an overrun and logged with the task whose step crossed it.
+    void run();
+
+    void set_budget(std::chrono::nanoseconds budget);
+
+    /// @}
+    /// @name Accessors
+    /// @{
+
+    [[nodiscard]] auto budget() const -> std::chrono::nanoseconds;
+
+    /// @brief Returns the number of tasks that aren't done yet.
+    [[nodiscard]] auto size() const -> std::size_t;
+
+    /// @brief Returns how long the last run() spent on steps.
+    [[nodiscard]] auto last_run_time() const -> std::chrono::nanoseconds;
+
+    /// @brief Returns the number of runs that exceeded the budget.
+    [[nodiscard]] auto overruns() const -> unsigned int;
+
+    /// @}
+
+  private:
+    struct Task {
+      std::string name;
+      std::function<bool()> step;
+    };
+
+    /// @{
+    /// Private state.
+    std::chrono::nanoseconds _budget;
+    std::deque<Task> _tasks;
+    std::vector<Task> _pushed; //< tasks pushed since the last run(), guarded by _push_mutex
+    mutable std::mutex _push_mutex;
+    std::chrono::nanoseconds _last_run_time = std::chrono::nanoseconds::zero();
+    unsigned int _overruns                  = 0;
+    /// @}
+  };
+
+}
@@ -1,56 +1,152 @@
 #include "update_scheduler.hpp"
 
+#include <algorithm>
 #include <utility>
 
 #include "../debug/logger.hpp"
 
 using namespace engine::time;
 
-UpdateScheduler::UpdateScheduler(std::vector<Schedule> schedules)
-        : _schedules(std::move(schedules)) {
+namespace {
+
+  auto scale(std::chrono::nanoseconds duration, float factor) -> std::chrono::nanoseconds {
+    return std::chrono::nanoseconds((std::chrono::nanoseconds::rep) ((double) duration.count() * factor));
+  }
+
+}
+
+UpdateScheduler::UpdateScheduler(std::vector<Schedule> schedules, std::chrono::nanoseconds spin_margin)
+        : UpdateScheduler(std::move(schedules), spin_margin, Clock()) {}
+
+UpdateScheduler::UpdateScheduler(std::vector<Schedule> schedules, std::chrono::nanoseconds spin_margin, Clock clock)
+        : _schedules(std::move(schedules)),
+          _spin_margin(spin_margin),
+          _clock(std::move(clock)) {
 
   _accumulators.resize(_schedules.size());
   _ticks.resize(_schedules.size());
 }
 
 /// @see https://gafferongames.com/post/fix_your_timestep/
-void UpdateScheduler::run(const bool& b) {
-  auto time_before_update = std::chrono::system_clock::now();
-  auto prev_log           = std::chrono::system_clock::now();
+void UpdateScheduler::run(const std::atomic<bool>& b) {
+  auto time_before_update = _clock.now();
+  auto prev_log           = time_before_update;
 
   while (b) {
 
     // NOTE: delta time (dt) in this case refers to time since last update.
-    auto dt = std::chrono::system_clock::now() - time_before_update;
-
-    time_before_update = std::chrono::system_clock::now();
+    auto now           = _clock.now();
+    auto dt            = now - time_before_update;
+    time_before_update = now;
 
     for (unsigned int i = 0; i < _schedules.size(); i++) {
-      _accumulators[i] += dt;
+      if (_schedules[i].target_dt == std::chrono::nanoseconds::zero()) {
+        _schedules[i].func(std::chrono::duration<float>(dt).count());
+        _ticks[i]++;
+        continue;
+      }
 
-      float dt_in_seconds = _schedules[i].fixed_dt
-                              ? std::chrono::duration<float>((_schedules[i].target_dt)).count()
-                              : std::chrono::duration<float>((dt)).count();
+      _accumulators[i] += _schedules[i].scaled ? scale(dt, _time_scale) : dt;
 
-      while (_accumulators[i] > _schedules[i].target_dt) {
-        if (_schedules[i].fixed_dt)
+      // A schedule that is slower than its target would otherwise run ever more steps per iteration.
+      unsigned int steps = 0;
+      while (_accumulators[i] >= _schedules[i].target_dt) {
+        if (_schedules[i].fixed_dt && steps == _schedules[i].max_catch_up) {
+          if (_schedules[i].overflow == Overflow::DROP) {
+            _dropped_ticks += _accumulators[i] / _schedules[i].target_dt;
+            _accumulators[i] %= _schedules[i].target_dt;
+          }
+          break;
+        }
+        steps++;
+
+        float dt_in_seconds = 0.0F;
+        if (_schedules[i].fixed_dt) {
+          dt_in_seconds = std::chrono::duration<float>(_schedules[i].target_dt).count();
           _accumulators[i] -= _schedules[i].target_dt;
-        else
+        } else {
+          // Variable schedules get the time since they last ran, not since the last iteration.
+          dt_in_seconds    = std::chrono::duration<float>(_accumulators[i]).count();
           _accumulators[i] = std::chrono::nanoseconds::zero();
+        }
 
         _schedules[i].func(dt_in_seconds);
         _ticks[i]++;
       }
     }
 
-    if (std::chrono::system_clock::now() - prev_log > std::chrono::seconds(1)) {
+    if (_clock.now() - prev_log > std::chrono::seconds(1)) {
       std::string s = "Scheduler: ";
       for (auto& _tick : _ticks) {
         s += std::to_string(_tick) + " ";
         _tick = 0;
       }
+      s += "(" + std::to_string(_dropped_ticks) + " dropped)";
       LOG_DEBUG(s);
-      prev_log = std::chrono::system_clock::now();
+      prev_log = _clock.now();
     }
+
+    wait_until(time_before_update + next_due());
+  }
+}
+
+void UpdateScheduler::set_time_scale(float scale) {
+  if (scale < 0.0F)
+    LOG_ERROR("The time scale must not be negative.");
+
+  _time_scale = scale;
+}
+
+auto UpdateScheduler::time_scale() const -> float {
+  return _time_scale;
+}
+
+auto UpdateScheduler::dropped_ticks() const -> std::uint64_t {
+  return _dropped_ticks;
+}
+
+auto UpdateScheduler::interpolation(unsigned int index) const -> float {
+  if (_schedules[index].target_dt == std::chrono::nanoseconds::zero())
+    return 0.0F;
+
+  return std::chrono::duration<float>(_accumulators[index]) / std::chrono::duration<float>(_schedules[index].target_dt);
+}
+
+auto UpdateScheduler::step_interval(unsigned int index) const -> std::chrono::nanoseconds {
+  return real_time(index, _schedules[index].target_dt, _time_scale);
+}
+
+auto UpdateScheduler::real_time(unsigned int index, std::chrono::nanoseconds duration, float time_scale) const -> std::chrono::nanoseconds {
+  if (!_schedules[index].scaled)
+    return duration;
+
+  // NOTE: Paused schedules are still checked once per step, so that the loop doesn't spin while everything is paused.
+  return time_scale > 0.0F ? scale(duration, 1.0F / time_scale) : _schedules[index].target_dt;
+}
+
+auto UpdateScheduler::next_due() const -> std::chrono::nanoseconds {
+  float time_scale = _time_scale;
+
+  auto due   = std::chrono::nanoseconds::max();
+  bool timed = false;
+  for (unsigned int i = 0; i < _schedules.size(); i++) {
+    if (_schedules[i].target_dt == std::chrono::nanoseconds::zero())
+      continue;
+
+    auto remaining = real_time(i, std::max(_schedules[i].target_dt - _accumulators[i], std::chrono::nanoseconds::zero()), time_scale);
+
+    due   = std::min(due, remaining);
+    timed = true;
   }
+
+  return timed ? due : std::chrono::nanoseconds::zero();
+}
+
+void UpdateScheduler::wait_until(std::chrono::steady_clock::time_point deadline) const {
+  // NOTE: Sleeps may overshoot by the scheduler's timer slack, so the last stretch is spun instead.
+  if (deadline - _clock.now() > _spin_margin)
+    _clock.sleep_until(deadline - _spin_margin);
+
+  while (_clock.now() < deadline)
+    _clock.yield();
 }
@@ -1,27 +1,86 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
+#include <thread>
 #include <vector>
 
 namespace engine::time {
   class UpdateScheduler {
   public:
+    /// @brief What a fixed schedule does with the time it could not catch up on within max_catch_up steps.
+    enum class Overflow {
+      DROP,  //< discards it, so the schedule falls behind real time but never builds a backlog
+      CARRY, //< keeps it, so the missed steps are made up during later iterations
+    };
+
     struct Schedule {
       std::function<void(float)> func;
-      std::chrono::nanoseconds target_dt = std::chrono::seconds(1);
+      std::chrono::nanoseconds target_dt = std::chrono::seconds(1); //< zero runs func once per loop iteration, i.e. right before any other schedule is due
       bool fixed_dt                      = false;
+      bool scaled                        = false; //< whether the time scale applies, e.g. to the simulation but not to input or GUI
+      unsigned int max_catch_up          = 5;     //< the most steps a fixed schedule runs per iteration when it is behind
+      Overflow overflow                  = Overflow::DROP;
+    };
+
+    /// @brief Clock is how the scheduler reads the time and waits for it to pass, which tests replace to control time.
+    struct Clock {
+      std::function<std::chrono::steady_clock::time_point()> now             = [] { return std::chrono::steady_clock::now(); };
+      std::function<void(std::chrono::steady_clock::time_point)> sleep_until = [](auto deadline) { std::this_thread::sleep_until(deadline); };
+      std::function<void()> yield                                            = [] { std::this_thread::yield(); }; //< called repeatedly while spinning
     };
 
     /// The functions will be updated in order of the vector.
-    UpdateScheduler(std::vector<Schedule> schedules);
+    ///
+    /// Between iterations the scheduler sleeps until \p spin_margin before the next schedule is due, and spins for the rest to make up for imprecise wake-ups.
+    /// A larger margin makes updates more punctual, and costs more CPU time while idle.
+    UpdateScheduler(std::vector<Schedule> schedules, std::chrono::nanoseconds spin_margin = std::chrono::microseconds(500));
+
+    /// @brief Creates a scheduler that reads the time from \p clock instead of std::chrono::steady_clock.
+    UpdateScheduler(std::vector<Schedule> schedules, std::chrono::nanoseconds spin_margin, Clock clock);
 
     /// Will run until \p b is false.
-    void run(const bool& b);
+    void run(const std::atomic<bool>& b);
+
+    /// @brief Scales how fast time passes for scaled schedules, e.g. 0.5 for slow motion, 2 for fast-forward, or 0 to pause them. Can be called from any thread.
+    ///
+    /// Fixed schedules keep their step size and run more or less often instead.
+    void set_time_scale(float scale);
+
+    [[nodiscard]] auto time_scale() const -> float;
+
+    /// @brief Returns the number of fixed steps that were skipped since the scheduler was created, see Overflow::DROP.
+    [[nodiscard]] auto dropped_ticks() const -> std::uint64_t;
+
+    /// @brief Returns how far the schedule at \p index has advanced towards its next step, as a fraction of its target_dt.
+    ///
+    /// Called from within a schedule, this is how much real time the state of the current step already lags behind, e.g. to interpolate rendering between fixed steps.
+    /// Must only be called on the thread that runs the scheduler.
+    [[nodiscard]] auto interpolation(unsigned int index) const -> float;
+
+    /// @brief Returns the real time between two steps of the schedule at \p index, i.e. its target_dt adjusted for the time scale.
+    ///
+    /// Paused schedules report their target_dt, just like when the scheduler waits for them.
+    [[nodiscard]] auto step_interval(unsigned int index) const -> std::chrono::nanoseconds;
 
   private:
     std::vector<Schedule> _schedules;
     std::vector<std::chrono::nanoseconds> _accumulators;
     std::vector<unsigned int> _ticks;
+    std::chrono::nanoseconds _spin_margin;
+    Clock _clock;
+    std::atomic<float> _time_scale            = 1.0F;
+    std::atomic<std::uint64_t> _dropped_ticks = 0;
+
+    /// @brief Converts \p duration of the time of the schedule at \p index into real time at \p time_scale.
+    [[nodiscard]] auto real_time(unsigned int index, std::chrono::nanoseconds duration, float time_scale) const -> std::chrono::nanoseconds;
+
+    /// @brief Returns how long after the last iteration the next schedule with a target_dt is due.
+    [[nodiscard]] auto next_due() const -> std::chrono::nanoseconds;
+
+    /// @brief Sleeps until shortly before \p deadline, and spins for the rest.
+    void wait_until(std::chrono::steady_clock::time_point deadline) const;
   };
 };
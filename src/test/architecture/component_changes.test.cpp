@@ -0,0 +1,63 @@
+#include "../util.hpp"
+
+#include "../../engine/architecture/component_changes.hpp"
+
+using namespace engine::architecture;
+
+namespace {
+
+  struct Value {
+    int value = 0;
+  };
+
+  struct FirstObserver {};
+  struct SecondObserver {};
+
+}
+
+TEST(ComponentChangesTest, Collects1) {
+  ECS ecs;
+  auto existing = ecs.create();
+  ecs.emplace<Value>(existing);
+
+  // Components that exist before the first call count as added.
+  auto& changed = changes<FirstObserver, Value>(ecs);
+  ASSERT_EQ(changed.added().size(), 1U);
+  EXPECT_EQ(changed.added()[0], existing);
+  changed.clear();
+  EXPECT_TRUE(changed.empty());
+
+  auto added   = ecs.create();
+  auto removed = ecs.create();
+  ecs.emplace<Value>(added);
+  ecs.emplace<Value>(removed);
+  ecs.replace<Value>(existing, 1);
+  ecs.replace<Value>(added, 2);
+
+  // Added components aren't also reported as updated, and removing them again leaves no trace.
+  ecs.remove<Value>(removed);
+  EXPECT_EQ(changed.added(), std::vector<EntityID>{added});
+  EXPECT_EQ(changed.updated(), std::vector<EntityID>{existing});
+  EXPECT_TRUE(changed.removed().empty());
+  changed.clear();
+
+  ecs.replace<Value>(added, 3);
+  ecs.destroy(added);
+  EXPECT_TRUE(changed.added().empty());
+  EXPECT_TRUE(changed.updated().empty());
+  EXPECT_EQ(changed.removed(), std::vector<EntityID>{added});
+}
+
+TEST(ComponentChangesTest, SeparatesObservers1) {
+  ECS ecs;
+  auto& first  = changes<FirstObserver, Value>(ecs);
+  auto& second = changes<SecondObserver, Value>(ecs);
+  EXPECT_EQ((&changes<FirstObserver, Value>(ecs)), &first);
+
+  auto entity = ecs.create();
+  ecs.emplace<Value>(entity);
+  first.clear();
+
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(second.added(), std::vector<EntityID>{entity});
+}
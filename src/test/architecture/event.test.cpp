@@ -0,0 +1,55 @@
+#include "../util.hpp"
+
+#include "../../engine/architecture/event.hpp"
+using namespace engine::architecture;
+
+TEST(EventTest, Unsubscribes1) {
+  Event<void(int)> event;
+  std::vector<int> received;
+
+  auto a = event.listen([&](int x) { received.push_back(x); });
+  {
+    auto b = event.listen([&](int x) { received.push_back(10 * x); });
+    event.trigger(1);
+    EXPECT_EQ(event.size(), 2U);
+  }
+  event.trigger(2);
+  EXPECT_EQ(received, (std::vector<int>{1, 10, 2}));
+
+  a.reset();
+  event.trigger(3);
+  EXPECT_EQ(received.size(), 3U);
+  EXPECT_EQ(event.size(), 0U);
+}
+
+TEST(EventTest, Unsubscribes2) {
+  // Listeners that stop listening during a trigger aren't called anymore, and those that start aren't called until the next one.
+  Event<void()> event;
+  unsigned int a_calls = 0;
+  unsigned int c_calls = 0;
+  Subscription b;
+  Subscription c;
+
+  auto a = event.listen([&] {
+    a_calls++;
+    b.reset();
+    if (a_calls == 1)
+      c = event.listen([&] { c_calls++; });
+  });
+  b = event.listen([] { ADD_FAILURE(); });
+
+  event.trigger();
+  EXPECT_EQ(c_calls, 0U);
+  event.trigger();
+  EXPECT_EQ(a_calls, 2U);
+  EXPECT_EQ(c_calls, 1U);
+}
+
+TEST(EventTest, OutlivesEvent1) {
+  Subscription subscription;
+  {
+    Event<void()> event;
+    subscription = event.listen([] {});
+  }
+  subscription.reset();
+}
@@ -0,0 +1,122 @@
+#include "../util.hpp"
+
+#include "../../engine/architecture/system_scheduler.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+using namespace engine::architecture;
+
+namespace {
+
+  struct A {};
+  struct B {};
+
+  /// Records the order in which systems ran.
+  // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+  class RecordingSystem : public IEntitySystem {
+  public:
+    RecordingSystem(SystemAccess access, std::vector<int>& log, std::mutex& mutex, int id)
+            : _access(std::move(access)),
+              _log(log),
+              _mutex(mutex),
+              _id(id) {}
+
+    void update([[maybe_unused]] ECS& ecs) override {
+      const std::lock_guard<std::mutex> lock(_mutex);
+      _log.push_back(_id);
+    }
+
+    [[nodiscard]] auto access() const -> SystemAccess override {
+      return _access;
+    }
+
+  private:
+    SystemAccess _access;
+    std::vector<int>& _log;
+    std::mutex& _mutex;
+    int _id;
+  };
+
+}
+
+TEST(SystemAccessTest, Conflicts1) {
+  SystemAccess read_a;
+  read_a.read<A>();
+  SystemAccess write_a;
+  write_a.write<A>();
+  SystemAccess write_b;
+  write_b.write<B>();
+  SystemAccess context;
+  context.read<B>().write_context<A>();
+
+  EXPECT_FALSE(read_a.conflicts_with(read_a));
+  EXPECT_TRUE(read_a.conflicts_with(write_a));
+  EXPECT_TRUE(write_a.conflicts_with(read_a));
+  EXPECT_FALSE(write_a.conflicts_with(write_b));
+  EXPECT_TRUE(write_b.conflicts_with(context));
+  EXPECT_TRUE(context.conflicts_with(context));
+
+  // Context variables don't conflict with components of the same type.
+  EXPECT_FALSE(context.conflicts_with(read_a));
+
+  // Systems that declare nothing conflict with everything.
+  EXPECT_TRUE(SystemAccess().conflicts_with(read_a));
+  EXPECT_TRUE(read_a.conflicts_with(SystemAccess()));
+}
+
+TEST(SystemAccessTest, Conflicts2) {
+  SystemAccess read_a;
+  read_a.read_context<A>();
+  SystemAccess write_a;
+  write_a.write_context<A>();
+  SystemAccess write_b;
+  write_b.write_context<B>();
+
+  EXPECT_FALSE(read_a.conflicts_with(read_a));
+  EXPECT_TRUE(read_a.conflicts_with(write_a));
+  EXPECT_FALSE(write_a.conflicts_with(write_b));
+
+  // Concurrent systems must not add variables to the context, so they are created up front.
+  ECS ecs;
+  write_a.prepare(ecs);
+  EXPECT_NE(ecs.try_ctx<A>(), nullptr);
+  EXPECT_EQ(ecs.try_ctx<B>(), nullptr);
+}
+
+TEST(SystemSchedulerTest, OrdersConflicts1) {
+  engine::job::JobSystem jobs(2);
+  SystemScheduler scheduler(jobs);
+  std::vector<int> log;
+  std::mutex mutex;
+
+  SystemAccess write_a;
+  write_a.write<A>();
+  SystemAccess read_a;
+  read_a.read<A>();
+  SystemAccess write_b;
+  write_b.write<B>();
+
+  scheduler.add("write_a", std::make_unique<RecordingSystem>(write_a, log, mutex, 0));
+  scheduler.add("read_a_1", std::make_unique<RecordingSystem>(read_a, log, mutex, 1));
+  scheduler.add("write_b", std::make_unique<RecordingSystem>(write_b, log, mutex, 2));
+  scheduler.add("read_a_2", std::make_unique<RecordingSystem>(read_a, log, mutex, 3));
+  scheduler.add("exclusive", std::make_unique<RecordingSystem>(SystemAccess(), log, mutex, 4));
+
+  // write_a and write_b, then both readers of A, then the exclusive system.
+  EXPECT_EQ(scheduler.wave_count(), 3U);
+
+  ECS ecs;
+  scheduler.run(ecs);
+
+  ASSERT_EQ(log.size(), 5U);
+  auto position = [&](int id) { return std::find(log.begin(), log.end(), id) - log.begin(); };
+  EXPECT_LT(position(0), position(1));
+  EXPECT_LT(position(0), position(3));
+  EXPECT_EQ(position(4), 4);
+
+  ASSERT_EQ(scheduler.timings().size(), 5U);
+  EXPECT_EQ(scheduler.timings()[2].name, "write_b");
+  for (const auto& timing : scheduler.timings())
+    EXPECT_GE(timing.milliseconds, 0);
+}
@@ -283,6 +283,23 @@ TEST(MatrixTest, Negates1) {
   EXPECT_EQ(-m, expected);
 }
 
+TEST(MatrixTest, Adds1) {
+  Matrix<2, 3> m1({
+    {7, 0, -4},
+    {-9, 3, 5},
+  });
+  Matrix<2, 3> m2({
+    {1, 2, 3},
+    {4, 5, 6},
+  });
+  Matrix<2, 3> expected({
+    {8, 2, -1},
+    {-5, 8, 11},
+  });
+  EXPECT_EQ(m1 + m2, expected);
+  EXPECT_EQ(m1 + -m1, (Matrix<2, 3>()));
+}
+
 TEST(MatrixTest, Inverse1) {
   Matrix<2> m({
     {4, 7},
@@ -0,0 +1,39 @@
+#include "../util.hpp"
+
+#include "../../engine/geometry/transform_batch.hpp"
+using namespace engine::geometry;
+
+TEST(TransformBatchTest, ComputesMatrices1) {
+  std::vector<Transform> transforms = {
+    Transform(),
+    Transform(Vector<3>(1.0F, -2.0F, 3.0F)),
+    Transform(Vector<3>(0.5F, 0.0F, -1.0F), Rotation(pi / 2.0F, 0.3F, -1.2F)),
+    Transform(Vector<3>(-4.0F, 2.0F, 0.0F), Rotation(0.1F, pi, 2.0F), Vector<3>(1.0F, 2.0F, 0.5F)),
+  };
+
+  TransformBatch batch;
+  batch.resize(transforms.size());
+  for (std::size_t i = 0; i < transforms.size(); i++)
+    batch.set(i, transforms[i]);
+
+  std::vector<Matrix<4>> matrices(transforms.size());
+  batch.compute_matrices(0, transforms.size(), matrices.data());
+  for (std::size_t i = 0; i < transforms.size(); i++)
+    EXPECT_EQ(matrices[i], transforms[i].matrix());
+}
+
+TEST(TransformBatchTest, ComputesMatrices2) {
+  TransformBatch batch;
+  batch.resize(3);
+  batch.set(0, Transform(Vector<3>(1.0F, 1.0F, 1.0F)));
+  batch.set(1, Transform(Vector<3>(2.0F, 2.0F, 2.0F)));
+  batch.set_identity(1);
+  batch.set(2, Transform(Vector<3>(3.0F, 3.0F, 3.0F)));
+
+  std::vector<Matrix<4>> matrices(3, Matrix<4>() * 2.0F);
+  batch.compute_matrices(1, 2, matrices.data());
+
+  EXPECT_EQ(matrices[0], Matrix<4>() * 2.0F);
+  EXPECT_EQ(matrices[1], Matrix<4>());
+  EXPECT_EQ(matrices[2], Matrix<4>() * 2.0F);
+}
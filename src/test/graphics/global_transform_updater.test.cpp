@@ -0,0 +1,39 @@
+#include "../util.hpp"
+
+#include "../../engine/graphics/component/global_transform.hpp"
+#include "../../engine/graphics/system/global_transform_updater.hpp"
+#include "../../engine/scene/component/node.hpp"
+#include "../../engine/scene/hierarchy.hpp"
+using namespace engine::architecture;
+using namespace engine::geometry;
+using namespace engine::graphics;
+
+TEST(GlobalTransformUpdaterTest, KeepsPrevious1) {
+  ECS ecs;
+  engine::job::JobSystem jobs(1);
+  system::GlobalTransformUpdater updater(jobs);
+
+  auto parent = ecs.create();
+  ecs.emplace<engine::scene::component::Node>(parent);
+  ecs.emplace<Transform>(parent, Transform(Vector<3>(1.0F, 0.0F, 0.0F)));
+  auto child = ecs.create();
+  ecs.emplace<engine::scene::component::Node>(child);
+  ecs.emplace<Transform>(child, Transform(Vector<3>(0.0F, 1.0F, 0.0F)));
+  engine::scene::attach(ecs, parent, child);
+  updater.update(ecs);
+
+  // New nodes have nothing to blend from.
+  auto first = ecs.get<component::GlobalTransform>(child).matrix;
+  EXPECT_EQ(ecs.get<component::GlobalTransform>(child).previous, first);
+  EXPECT_EQ(first, Transform(Vector<3>(1.0F, 1.0F, 0.0F)).matrix());
+
+  // Moving the parent moves the child, which keeps its matrix of the previous update.
+  ecs.get<Transform>(parent) = Transform(Vector<3>(2.0F, 0.0F, 0.0F));
+  updater.update(ecs);
+  EXPECT_EQ(ecs.get<component::GlobalTransform>(child).previous, first);
+  EXPECT_EQ(ecs.get<component::GlobalTransform>(child).matrix, Transform(Vector<3>(2.0F, 1.0F, 0.0F)).matrix());
+
+  // Once nothing moves, both are the same again.
+  updater.update(ecs);
+  EXPECT_EQ(ecs.get<component::GlobalTransform>(child).previous, ecs.get<component::GlobalTransform>(child).matrix);
+}
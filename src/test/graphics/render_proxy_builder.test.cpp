@@ -0,0 +1,119 @@
+#include "../util.hpp"
+
+#include "../../engine/graphics/component/cuboid.hpp"
+#include "../../engine/graphics/component/global_transform.hpp"
+#include "../../engine/graphics/component/line_segment.hpp"
+#include "../../engine/graphics/component/render_proxies.hpp"
+#include "../../engine/graphics/system/render_proxy_builder.hpp"
+#include "../../engine/scene/component/static.hpp"
+using namespace engine::architecture;
+using namespace engine::graphics;
+
+TEST(RenderProxyBuilderTest, UploadsMeshes1) {
+  ECS ecs;
+  system::RenderProxyBuilder builder;
+
+  auto cuboid = ecs.create();
+  ecs.emplace<component::Cuboid>(cuboid);
+  ecs.emplace<component::GlobalTransform>(cuboid);
+  builder.update(ecs);
+
+  auto& proxies = ecs.ctx<component::RenderProxies>();
+  auto& updates = ecs.ctx<component::MeshUpdates>();
+  auto mesh     = ecs.get<component::Cuboid>(cuboid).mesh;
+  ASSERT_EQ(proxies.cuboids.size(), 1U);
+  EXPECT_NE(mesh, 0U);
+  EXPECT_EQ(proxies.cuboids[0].mesh, mesh);
+  ASSERT_EQ(updates.meshes.size(), 1U);
+  EXPECT_EQ(updates.meshes[0].mesh, mesh);
+  EXPECT_EQ(updates.meshes[0].vertices.size(), 8U);
+  EXPECT_EQ(updates.meshes[0].indices.size(), 36U);
+
+  // Unchanged meshes are only uploaded once.
+  updates.meshes.clear();
+  builder.update(ecs);
+  EXPECT_TRUE(updates.meshes.empty());
+
+  // Copies get their own mesh.
+  auto copy = ecs.create();
+  ecs.emplace<component::Cuboid>(copy, ecs.get<component::Cuboid>(cuboid));
+  builder.update(ecs);
+  ASSERT_EQ(updates.meshes.size(), 1U);
+  EXPECT_NE(ecs.get<component::Cuboid>(copy).mesh, mesh);
+
+  ecs.destroy(cuboid);
+  EXPECT_EQ(updates.released, std::vector<unsigned int>{mesh});
+}
+
+TEST(RenderProxyBuilderTest, UploadsMeshes2) {
+  // The context of the ECS is set up by the SystemScheduler when the builder runs concurrently with other systems.
+  ECS ecs;
+  system::RenderProxyBuilder builder;
+  builder.access().prepare(ecs);
+
+  auto cuboid = ecs.create();
+  ecs.emplace<component::Cuboid>(cuboid);
+  ecs.emplace<component::GlobalTransform>(cuboid);
+  builder.update(ecs);
+
+  auto mesh = ecs.get<component::Cuboid>(cuboid).mesh;
+  EXPECT_EQ(ecs.ctx<component::RenderProxies>().cuboids.size(), 1U);
+  EXPECT_EQ(ecs.ctx<component::MeshUpdates>().meshes.size(), 1U);
+
+  ecs.destroy(cuboid);
+  EXPECT_EQ(ecs.ctx<component::MeshUpdates>().released, std::vector<unsigned int>{mesh});
+}
+
+TEST(RenderProxyBuilderTest, BlendsModels1) {
+  ECS ecs;
+  system::RenderProxyBuilder builder;
+
+  auto cuboid = ecs.create();
+  ecs.emplace<component::Cuboid>(cuboid);
+  auto& global    = ecs.emplace<component::GlobalTransform>(cuboid);
+  global.previous = engine::geometry::Transform(engine::geometry::Vector<3>(0.0F, 0.0F, 0.0F)).matrix();
+  global.matrix   = engine::geometry::Transform(engine::geometry::Vector<3>(4.0F, 0.0F, 0.0F)).matrix();
+  builder.update(ecs);
+
+  const auto& proxy = ecs.ctx<component::RenderProxies>().cuboids.at(0);
+  EXPECT_EQ(proxy.previous_model, global.previous);
+  EXPECT_EQ(proxy.blended_model(1.0F), global.matrix);
+  EXPECT_EQ(proxy.blended_model(0.0F), global.previous);
+  EXPECT_EQ(proxy.blended_model(0.25F), engine::geometry::Transform(engine::geometry::Vector<3>(1.0F, 0.0F, 0.0F)).matrix());
+}
+
+TEST(RenderProxyBuilderTest, UploadsLines1) {
+  ECS ecs;
+  system::RenderProxyBuilder builder;
+
+  engine::geometry::LineSegment<3> line(engine::geometry::Point<3>(0.0F, 0.0F, 0.0F), engine::geometry::Point<3>(1.0F, 0.0F, 0.0F));
+  component::LineSegments segments;
+  segments.line_segments = {{line}, {line}, {line, Color(), 2.0F}};
+
+  auto dynamic_lines = ecs.create();
+  ecs.emplace<component::LineSegments>(dynamic_lines, segments);
+  auto static_lines = ecs.create();
+  ecs.emplace<component::LineSegments>(static_lines, segments);
+  ecs.emplace<engine::scene::component::Static>(static_lines);
+  builder.update(ecs);
+
+  auto& proxies = ecs.ctx<component::RenderProxies>();
+  auto& updates = ecs.ctx<component::MeshUpdates>();
+  ASSERT_EQ(proxies.lines.size(), 2U);
+  EXPECT_EQ(updates.lines.size(), 2U);
+
+  // Segments of the same width are drawn as one batch.
+  const auto& batches = proxies.lines[0].batches;
+  ASSERT_EQ(batches.size(), 2U);
+  EXPECT_EQ(batches[0].first, 0);
+  EXPECT_EQ(batches[0].count, 4);
+  EXPECT_EQ(batches[1].first, 4);
+  EXPECT_EQ(batches[1].count, 2);
+
+  // Only dynamic lines are uploaded again.
+  updates.lines.clear();
+  builder.update(ecs);
+  ASSERT_EQ(updates.lines.size(), 1U);
+  EXPECT_EQ(updates.lines[0].mesh, ecs.get<component::LineSegments>(dynamic_lines).mesh);
+  EXPECT_EQ(updates.lines[0].colors.size(), 6U);
+}
@@ -0,0 +1,89 @@
+#include "../util.hpp"
+
+#include "../../engine/job/command_queue.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace engine::job;
+
+TEST(CommandQueueTest, Constructs1) {
+  EXPECT_EQ(CommandQueue(1).capacity(), 2U);
+  EXPECT_EQ(CommandQueue(5).capacity(), 8U);
+  EXPECT_EQ(CommandQueue(8).capacity(), 8U);
+}
+
+TEST(CommandQueueTest, Drains1) {
+  CommandQueue queue(4);
+  std::vector<int> order;
+
+  EXPECT_EQ(queue.drain(), 0U);
+  for (int i = 0; i < 3; i++)
+    queue.push([&order, i] { order.push_back(i); });
+  EXPECT_TRUE(order.empty());
+
+  EXPECT_EQ(queue.drain(), 3U);
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+  EXPECT_EQ(queue.drain(), 0U);
+}
+
+TEST(CommandQueueTest, Bounds1) {
+  CommandQueue queue(2);
+  int count = 0;
+
+  EXPECT_TRUE(queue.try_push([&count] { count++; }));
+  EXPECT_TRUE(queue.try_push([&count] { count++; }));
+
+  // A rejected command is left intact.
+  std::function<void()> command = [&count] { count += 10; };
+  EXPECT_FALSE(queue.try_push(std::move(command)));
+  EXPECT_TRUE(command);
+
+  queue.drain();
+  EXPECT_TRUE(queue.try_push(std::move(command)));
+  queue.drain();
+  EXPECT_EQ(count, 12);
+}
+
+TEST(CommandQueueTest, Submits1) {
+  CommandQueue queue(4);
+
+  auto result = queue.submit([] { return 42; });
+  auto done   = queue.submit([] {});
+  EXPECT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+
+  queue.drain();
+  EXPECT_EQ(result.get(), 42);
+  EXPECT_NO_THROW(done.get());
+
+  std::future<int> broken;
+  {
+    CommandQueue dropped(4);
+    broken = dropped.submit([] { return 0; });
+  }
+  EXPECT_THROW(broken.get(), std::future_error);
+}
+
+TEST(CommandQueueTest, Drains2) {
+  // Producers block on the full queue until the consumer catches up.
+  CommandQueue queue(8);
+  constexpr int producers = 4;
+  constexpr int commands  = 1000;
+
+  std::atomic<int> sum = 0;
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&queue, &sum] {
+      for (int i = 1; i <= commands; i++)
+        queue.push([&sum, i] { sum += i; });
+    });
+  }
+
+  std::size_t drained = 0;
+  while (drained < producers * commands)
+    drained += queue.drain();
+
+  for (auto& thread : threads)
+    thread.join();
+  EXPECT_EQ(sum, producers * commands * (commands + 1) / 2);
+}
@@ -0,0 +1,91 @@
+#include "../util.hpp"
+
+#include "../../engine/job/job_system.hpp"
+
+#include <atomic>
+#include <numeric>
+
+using namespace engine::job;
+
+TEST(JobSystemTest, ParallelFor1) {
+  for (unsigned int workers : {0U, 1U, 3U}) {
+    JobSystem jobs(workers);
+
+    std::vector<int> values(10000, 0);
+    jobs.parallel_for(values.size(), 16, [&](std::size_t begin, std::size_t end) {
+      for (auto i = begin; i < end; i++)
+        values[i]++;
+    });
+
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 10000);
+  }
+}
+
+TEST(JobSystemTest, NestedParallelFor1) {
+  JobSystem jobs(2);
+
+  std::atomic<int> sum = 0;
+  jobs.parallel_for(8, 1, [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; i++)
+      jobs.parallel_for(100, 1, [&](std::size_t inner_begin, std::size_t inner_end) {
+        sum += static_cast<int>(inner_end - inner_begin);
+      });
+  });
+
+  EXPECT_EQ(sum, 800);
+}
+
+TEST(JobSystemTest, Dependencies1) {
+  JobSystem jobs(3);
+
+  // Each job checks that all jobs it depends on are done.
+  std::atomic<int> first_done = 0;
+  std::atomic<bool> ordered   = true;
+
+  JobSystem::Counter first;
+  for (int i = 0; i < 50; i++)
+    jobs.run([&] { first_done++; }, first);
+
+  auto second = jobs.run_after(first, [&] {
+    if (first_done != 50)
+      ordered = false;
+  });
+  auto third = jobs.run_after(second, [] {});
+
+  jobs.wait(third);
+  EXPECT_TRUE(first.is_done());
+  EXPECT_TRUE(second.is_done());
+  EXPECT_TRUE(ordered);
+
+  // Depending on a finished counter schedules right away.
+  jobs.wait(jobs.run_after(first, [] {}));
+}
+
+TEST(JobSystemTest, MainThreadAffinity1) {
+  JobSystem jobs(2);
+  EXPECT_TRUE(jobs.is_main_thread());
+
+  std::atomic<bool> on_main_thread = false;
+  auto counter                     = jobs.run([&] { on_main_thread = jobs.is_main_thread(); }, Affinity::MAIN_THREAD);
+  EXPECT_FALSE(counter.is_done());
+
+  jobs.run_main_thread_jobs();
+  EXPECT_TRUE(counter.is_done());
+  EXPECT_TRUE(on_main_thread);
+
+  // Waiting on the main thread also runs main thread jobs, also those that only become ready later.
+  auto background = jobs.run([] {});
+  auto graphics   = jobs.run_after(background, [&] { on_main_thread = jobs.is_main_thread(); }, Affinity::MAIN_THREAD);
+  on_main_thread  = false;
+  jobs.wait(graphics);
+  EXPECT_TRUE(on_main_thread);
+
+  // Workers never run main thread jobs.
+  std::atomic<bool> worker_ran_main_job = false;
+  auto from_worker                      = jobs.run([&] {
+    jobs.run([&] { worker_ran_main_job = !jobs.is_main_thread(); }, Affinity::MAIN_THREAD);
+  });
+  jobs.wait(from_worker);
+  jobs.run_main_thread_jobs();
+  EXPECT_FALSE(worker_ran_main_job);
+}
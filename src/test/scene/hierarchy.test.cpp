@@ -0,0 +1,160 @@
+#include "../util.hpp"
+
+#include "../../engine/scene/component/static.hpp"
+#include "../../engine/scene/hierarchy.hpp"
+#include "../../engine/scene/node.hpp"
+#include "../../engine/scene/node_pool.hpp"
+using namespace engine::architecture;
+using namespace engine::scene;
+
+static auto create_node(ECS& ecs) -> EntityID {
+  auto e = ecs.create();
+  ecs.emplace<component::Node>(e);
+  return e;
+}
+
+static auto children_of(const ECS& ecs, EntityID parent) -> std::vector<EntityID> {
+  std::vector<EntityID> children;
+  for_each_child(ecs, parent, [&](EntityID child) { children.push_back(child); });
+  return children;
+}
+
+TEST(HierarchyTest, Attach1) {
+  ECS ecs;
+  auto root = create_node(ecs);
+  auto a    = create_node(ecs);
+  auto b    = create_node(ecs);
+  auto c    = create_node(ecs);
+
+  attach(ecs, root, a);
+  attach(ecs, root, b);
+  attach(ecs, a, c);
+
+  EXPECT_EQ(children_of(ecs, root), (std::vector<EntityID>{a, b}));
+  EXPECT_EQ(children_of(ecs, a), (std::vector<EntityID>{c}));
+  EXPECT_EQ(ecs.get<component::Node>(root).child_count, 2);
+  EXPECT_EQ(ecs.get<component::Node>(b).parent, root);
+  EXPECT_EQ(ecs.get<component::Node>(c).depth, 2);
+}
+
+TEST(HierarchyTest, Attach2) {
+  ECS ecs;
+  auto root = create_node(ecs);
+  auto a    = create_node(ecs);
+
+  attach(ecs, root, a);
+  EXPECT_THROW(attach(ecs, root, a), std::runtime_error);
+}
+
+TEST(HierarchyTest, MovesBelowItself1) {
+  ECS ecs;
+  NodePool pool;
+  auto root_id = create_node(ecs);
+  auto& root   = pool.create(ecs, root_id);
+  auto& a      = root.add_child();
+  auto& child  = a.add_child();
+
+  // Nodes can't be moved below themselves or their descendants, and stay where they are.
+  EXPECT_THROW(a.move_to(a), std::runtime_error);
+  EXPECT_THROW(a.move_to(child), std::runtime_error);
+  EXPECT_EQ(children_of(ecs, root_id).size(), 1U);
+  EXPECT_EQ(ecs.get<component::Node>(children_of(ecs, root_id)[0]).child_count, 1);
+}
+
+TEST(HierarchyTest, Detach1) {
+  ECS ecs;
+  auto root = create_node(ecs);
+  auto a    = create_node(ecs);
+  auto b    = create_node(ecs);
+  auto c    = create_node(ecs);
+  auto d    = create_node(ecs);
+
+  attach(ecs, root, a);
+  attach(ecs, root, b);
+  attach(ecs, root, c);
+  attach(ecs, b, d);
+
+  detach(ecs, b);
+  EXPECT_EQ(children_of(ecs, root), (std::vector<EntityID>{a, c}));
+  EXPECT_EQ(ecs.get<component::Node>(b).parent, NullEntityID);
+  EXPECT_EQ(ecs.get<component::Node>(b).depth, 0);
+  EXPECT_EQ(ecs.get<component::Node>(d).depth, 1);
+
+  detach(ecs, a);
+  detach(ecs, c);
+  EXPECT_TRUE(children_of(ecs, root).empty());
+  EXPECT_EQ(ecs.get<component::Node>(root).child_count, 0);
+
+  attach(ecs, c, b);
+  EXPECT_EQ(ecs.get<component::Node>(d).depth, 2);
+}
+
+TEST(HierarchyTest, SortsParentsFirst1) {
+  ECS ecs;
+  auto root = create_node(ecs);
+
+  std::vector<EntityID> nodes(50);
+  for (auto& n : nodes)
+    n = create_node(ecs);
+
+  attach(ecs, root, nodes[0]);
+  for (unsigned int i = 1; i < nodes.size(); i++)
+    attach(ecs, nodes[(i - 1) / 2], nodes[i]);
+
+  std::vector<EntityID> visited;
+  for (auto e : hierarchy_order(ecs).nodes) {
+    auto parent = ecs.get<component::Node>(e).parent;
+    if (parent != NullEntityID) {
+      EXPECT_NE(std::find(visited.begin(), visited.end(), parent), visited.end());
+    }
+    visited.push_back(e);
+  }
+  EXPECT_EQ(visited.size(), nodes.size() + 1);
+}
+
+TEST(HierarchyTest, StaticNodesLast1) {
+  ECS ecs;
+  auto root = create_node(ecs);
+  auto a    = create_node(ecs);
+  auto b    = create_node(ecs);
+  auto c    = create_node(ecs);
+
+  attach(ecs, root, a);
+  attach(ecs, root, b);
+  attach(ecs, a, c);
+  ecs.emplace<component::Static>(a);
+  ecs.emplace<component::Static>(c);
+
+  const auto& order = hierarchy_order(ecs);
+  EXPECT_EQ(order.static_begin, 2U);
+  EXPECT_EQ(order.nodes.size(), 4U);
+  EXPECT_EQ(order.levels, (std::vector<std::size_t>{0, 1}));
+  EXPECT_EQ((std::vector<EntityID>(order.nodes.begin() + 2, order.nodes.end())), (std::vector<EntityID>{a, c}));
+
+  auto version = order.version;
+  EXPECT_EQ(hierarchy_order(ecs).version, version);
+  detach(ecs, b);
+  EXPECT_NE(hierarchy_order(ecs).version, version);
+}
+
+TEST(HierarchyTest, DestroySubtree1) {
+  ECS ecs;
+  auto root = create_node(ecs);
+  auto a    = create_node(ecs);
+  auto b    = create_node(ecs);
+  auto c    = create_node(ecs);
+  auto d    = create_node(ecs);
+
+  attach(ecs, root, a);
+  attach(ecs, root, b);
+  attach(ecs, a, c);
+  attach(ecs, a, d);
+  EXPECT_EQ(subtree(ecs, root), (std::vector<EntityID>{root, a, c, d, b}));
+
+  auto destroyed = destroy_subtree(ecs, a);
+  EXPECT_EQ(destroyed, (std::vector<EntityID>{a, c, d}));
+  EXPECT_EQ(children_of(ecs, root), (std::vector<EntityID>{b}));
+  EXPECT_EQ(ecs.size<component::Node>(), 2U);
+  for (auto e : destroyed)
+    EXPECT_FALSE(ecs.valid(e));
+}
@@ -0,0 +1,188 @@
+#include "../util.hpp"
+
+#include "../../engine/graphics/component/cuboid.hpp"
+#include "../../engine/scene/factory.hpp"
+#include "../../engine/scene/manager.hpp"
+
+#include <thread>
+using namespace engine;
+using namespace engine::scene;
+
+namespace {
+
+  /// Counts the key presses it receives for as long as it is alive.
+  class KeyCounter : public IScript {
+  public:
+    static inline unsigned int presses = 0;
+
+    KeyCounter(SceneAPI& api, [[maybe_unused]] Node& root)
+            : _on_key(api.input_manager().on_key([this](const os::Window&, os::KeyCode, os::KeyAction, const os::ActivatedModifiers&) {
+                presses += _weight;
+              })) {}
+
+    void update([[maybe_unused]] float delta_time) override {}
+
+  private:
+    unsigned int _weight = 1;
+    architecture::Subscription _on_key;
+  };
+
+  /// Records the threads that its assets and its script are loaded on.
+  class ThreadRecorder : public IScript {
+  public:
+    static inline std::thread::id assets_thread;
+    static inline std::thread::id script_thread;
+
+    ThreadRecorder([[maybe_unused]] SceneAPI& api, [[maybe_unused]] Node& root) {
+      script_thread = std::this_thread::get_id();
+    }
+
+    void update([[maybe_unused]] float delta_time) override {}
+  };
+
+  /// Moves its camera one unit along x per update.
+  // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+  class MovingCamera : public IScript {
+  public:
+    MovingCamera(SceneAPI& api, [[maybe_unused]] Node& root)
+            : _api(api) {
+      _api.camera = &_camera;
+    }
+
+    ~MovingCamera() override {
+      _api.camera = nullptr;
+    }
+
+    void update([[maybe_unused]] float delta_time) override {
+      _camera.rigidbody().position()[0] += 1.0F;
+    }
+
+  private:
+    SceneAPI& _api;
+    graphics::Camera _camera;
+  };
+
+  /// Adds a single cuboid to its scene.
+  class CuboidScript : public IScript {
+  public:
+    CuboidScript([[maybe_unused]] SceneAPI& api, Node& root) {
+      root.add_child().add_component<graphics::component::Cuboid>();
+    }
+
+    void update([[maybe_unused]] float delta_time) override {}
+  };
+
+  struct ThreadRecorderFactory : Factory<ThreadRecorder> {
+    void load_assets([[maybe_unused]] SceneAPI& api) override {
+      ThreadRecorder::assets_thread = std::this_thread::get_id();
+    }
+  };
+
+}
+
+TEST(ManagerTest, LoadsAsync1) {
+  job::JobSystem jobs(1);
+  time::TaskQueue tasks(std::chrono::milliseconds(1));
+  graphics::AssetLoader assets(jobs, 1);
+  graphics::FrameBuilder frames(jobs);
+  os::InputManager input;
+
+  std::vector<std::unique_ptr<IFactory>> factories;
+  factories.push_back(std::make_unique<Factory<KeyCounter>>());
+  factories.push_back(std::make_unique<ThreadRecorderFactory>());
+  Manager manager(input, frames, [](graphics::RenderSnapshot) {}, jobs, tasks, assets, std::move(factories));
+
+  manager.load_async(1);
+  while (!manager.is_loaded(1))
+    manager.update(0.01F, {});
+
+  // Only the assets are loaded in the background, since scripts touch state that the engine thread uses.
+  EXPECT_NE(ThreadRecorder::assets_thread, std::this_thread::get_id());
+  EXPECT_EQ(ThreadRecorder::script_thread, std::this_thread::get_id());
+}
+
+TEST(ManagerTest, BlendsCamera1) {
+  job::JobSystem jobs(1);
+  time::TaskQueue tasks(std::chrono::milliseconds(1));
+  graphics::AssetLoader assets(jobs, 1);
+  graphics::FrameBuilder frames(jobs);
+  os::InputManager input;
+
+  std::vector<graphics::RenderSnapshot> snapshots;
+  std::vector<std::unique_ptr<IFactory>> factories;
+  factories.push_back(std::make_unique<Factory<MovingCamera>>());
+  Manager manager(input, frames, [&](graphics::RenderSnapshot snapshot) { snapshots.push_back(std::move(snapshot)); }, jobs, tasks, assets, std::move(factories));
+
+  manager.update(0.01F, {});
+  manager.update(0.01F, {});
+  ASSERT_EQ(snapshots.size(), 2U);
+
+  // The first snapshot has nothing to blend from, the second one blends from the first.
+  EXPECT_EQ(snapshots[0].previous_view_projection, snapshots[0].view_projection);
+  EXPECT_EQ(snapshots[1].previous_view_projection, snapshots[0].view_projection);
+  EXPECT_NE(snapshots[1].view_projection, snapshots[0].view_projection);
+  EXPECT_EQ(snapshots[1].blended_view_projection(0.0F), snapshots[0].view_projection);
+  EXPECT_EQ(snapshots[1].blended_view_projection(1.0F), snapshots[1].view_projection);
+  EXPECT_EQ(snapshots[1].blended_view_projection(0.5F), snapshots[0].view_projection * 0.5F + snapshots[1].view_projection * 0.5F);
+}
+
+TEST(ManagerTest, UnloadReleasesMeshes1) {
+  job::JobSystem jobs(1);
+  time::TaskQueue tasks(std::chrono::milliseconds(1));
+  graphics::AssetLoader assets(jobs, 1);
+  graphics::FrameBuilder frames(jobs);
+  os::InputManager input;
+
+  std::vector<graphics::RenderSnapshot> snapshots;
+  std::vector<std::unique_ptr<IFactory>> factories;
+  factories.push_back(std::make_unique<Factory<CuboidScript>>());
+  Manager manager(input, frames, [&](graphics::RenderSnapshot snapshot) { snapshots.push_back(std::move(snapshot)); }, jobs, tasks, assets, std::move(factories));
+
+  manager.update(0.01F, {});
+  ASSERT_EQ(snapshots.size(), 1U);
+  ASSERT_EQ(snapshots[0].meshes.size(), 1U);
+  auto mesh = snapshots[0].meshes[0].mesh;
+
+  // The scene is destroyed at the end of the update, so its meshes are released with the next snapshot.
+  manager.unload(0);
+  manager.update(0.01F, {});
+  manager.update(0.01F, {});
+  ASSERT_EQ(snapshots.size(), 3U);
+  EXPECT_EQ(snapshots[2].released, std::vector<unsigned int>{mesh});
+}
+
+TEST(ManagerTest, UnloadRemovesInputCallbacks1) {
+  // NOTE: Input events need a window, which needs a display.
+  if (glfwInit() == GLFW_FALSE)
+    GTEST_SKIP() << "GLFW can't be initialised without a display.";
+
+  {
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    os::Window window(64, 64);
+
+    job::JobSystem jobs(1);
+    time::TaskQueue tasks(std::chrono::milliseconds(1));
+    graphics::AssetLoader assets(jobs, 1);
+    graphics::FrameBuilder frames(jobs);
+    os::InputManager input;
+
+    std::vector<std::unique_ptr<IFactory>> factories;
+    factories.push_back(std::make_unique<Factory<KeyCounter>>());
+    Manager manager(input, frames, [](graphics::RenderSnapshot) {}, jobs, tasks, assets, std::move(factories));
+
+    KeyCounter::presses = 0;
+    input.push_key(window, GLFW_KEY_A, os::KeyAction::PRESS, {});
+    input.dispatch_events();
+    EXPECT_EQ(KeyCounter::presses, 1U);
+
+    // The unloaded script must not be called anymore, since it has been destroyed.
+    manager.unload(0);
+    manager.update(0.01F, {});
+    ASSERT_FALSE(manager.is_loaded(0));
+    input.push_key(window, GLFW_KEY_A, os::KeyAction::PRESS, {});
+    input.dispatch_events();
+    EXPECT_EQ(KeyCounter::presses, 1U);
+  }
+
+  glfwTerminate();
+}
@@ -0,0 +1,59 @@
+#include "../util.hpp"
+
+#include "../../engine/scene/component/name.hpp"
+#include "../../engine/scene/hierarchy.hpp"
+#include "../../engine/scene/name_index.hpp"
+using namespace engine::architecture;
+using namespace engine::scene;
+
+static auto create_node(ECS& ecs, EntityID parent, const std::string& name) -> EntityID {
+  auto e = ecs.create();
+  ecs.emplace<component::Node>(e);
+  if (!name.empty())
+    ecs.emplace<component::Name>(e, name);
+  if (parent != NullEntityID)
+    attach(ecs, parent, e);
+  return e;
+}
+
+TEST(NameIndexTest, FindsByName1) {
+  ECS ecs;
+  auto root = create_node(ecs, NullEntityID, "");
+  auto cube = create_node(ecs, root, "cube");
+
+  EXPECT_EQ(find_by_name(ecs, "cube"), cube);
+  EXPECT_EQ(find_by_name(ecs, "sphere"), NullEntityID);
+
+  // Names added after the index was built are found as well.
+  auto sphere = create_node(ecs, root, "sphere");
+  EXPECT_EQ(find_by_name(ecs, "sphere"), sphere);
+
+  ecs.replace<component::Name>(sphere, "ball");
+  EXPECT_EQ(find_by_name(ecs, "sphere"), NullEntityID);
+  EXPECT_EQ(find_by_name(ecs, "ball"), sphere);
+
+  ecs.destroy(sphere);
+  EXPECT_EQ(find_by_name(ecs, "ball"), NullEntityID);
+}
+
+TEST(NameIndexTest, FindsByPath1) {
+  ECS ecs;
+  auto root   = create_node(ecs, NullEntityID, "");
+  auto cube_a = create_node(ecs, root, "cube_a");
+  auto cube_b = create_node(ecs, root, "cube_b");
+  auto piece  = create_node(ecs, cube_a, "piece");
+  auto other  = create_node(ecs, cube_b, "piece");
+
+  EXPECT_EQ(find_by_path(ecs, root, "cube_a/piece"), piece);
+  EXPECT_EQ(find_by_path(ecs, root, "cube_b/piece"), other);
+  EXPECT_EQ(find_by_path(ecs, cube_a, "piece"), piece);
+  EXPECT_EQ(find_by_path(ecs, root, ""), root);
+  EXPECT_EQ(find_by_path(ecs, root, "piece"), NullEntityID);
+  EXPECT_EQ(find_by_path(ecs, root, "cube_a/piece/"), NullEntityID);
+
+  // Moving a node changes its path.
+  detach(ecs, piece);
+  EXPECT_EQ(find_by_path(ecs, root, "cube_a/piece"), NullEntityID);
+  attach(ecs, root, piece);
+  EXPECT_EQ(find_by_path(ecs, root, "piece"), piece);
+}
@@ -0,0 +1,86 @@
+#include "../util.hpp"
+
+#include "../../engine/architecture/component_changes.hpp"
+#include "../../engine/scene/component/node.hpp"
+#include "../../engine/scene/hierarchy.hpp"
+#include "../../engine/scene/node_pool.hpp"
+using namespace engine::architecture;
+using namespace engine::scene;
+
+TEST(NodePoolTest, KeepsAddresses1) {
+  ECS ecs;
+  NodePool pool;
+
+  auto root_id = ecs.create();
+  ecs.emplace<component::Node>(root_id);
+  auto& root = pool.create(ecs, root_id);
+
+  std::vector<Node*> children;
+  for (std::size_t i = 0; i < 3 * NodePool::chunk_size; i++)
+    children.push_back(&root.add_child());
+
+  EXPECT_EQ(pool.size(), 3 * NodePool::chunk_size + 1);
+  EXPECT_EQ(ecs.get<component::Node>(root_id).child_count, 3 * NodePool::chunk_size);
+
+  // Adding children to earlier nodes must not move any of them.
+  for (auto* child : children)
+    child->add_child();
+  EXPECT_EQ(pool.size(), 6 * NodePool::chunk_size + 1);
+}
+
+TEST(NodePoolTest, DoesNotMove1) {
+  // Nodes refer back to their pool, so a moved pool would leave them with a dangling one.
+  EXPECT_FALSE(std::is_move_constructible_v<NodePool>);
+  EXPECT_FALSE(std::is_move_assignable_v<NodePool>);
+  EXPECT_FALSE(std::is_copy_constructible_v<NodePool>);
+}
+
+TEST(NodePoolTest, ReusesReleased1) {
+  ECS ecs;
+  NodePool pool;
+
+  auto root_id = ecs.create();
+  ecs.emplace<component::Node>(root_id);
+  auto& root = pool.create(ecs, root_id);
+
+  auto& a = root.add_child();
+  a.add_child();
+  auto* a_address = &a;
+  auto& b         = root.add_child();
+  EXPECT_EQ(pool.size(), 4U);
+
+  a.destroy();
+  EXPECT_EQ(pool.size(), 2U);
+  EXPECT_EQ(ecs.size<component::Node>(), 2U);
+  EXPECT_EQ(ecs.get<component::Node>(root_id).child_count, 1U);
+
+  // Released slots are reused, so the next nodes don't need new memory.
+  auto& c = root.add_child();
+  root.add_child();
+  EXPECT_EQ(pool.size(), 4U);
+  EXPECT_TRUE(&c == a_address || &c == a_address + 1);
+  EXPECT_NE(&c, &b);
+}
+
+TEST(NodeTest, Patches1) {
+  struct Health {
+    int points = 0;
+  };
+
+  ECS ecs;
+  NodePool pool;
+  auto id = ecs.create();
+  ecs.emplace<component::Node>(id);
+  auto& node = pool.create(ecs, id);
+  node.add_component<Health>();
+
+  // Only patches notify the observers, reading or writing through component() doesn't.
+  auto& changes = engine::architecture::changes<Health, Health>(ecs);
+  changes.clear();
+  node.component<Health>().points = 1;
+  EXPECT_TRUE(changes.empty());
+
+  node.patch<Health>([](Health& health) { health.points++; });
+  EXPECT_EQ(node.component<Health>().points, 2);
+  EXPECT_EQ(changes.updated(), std::vector<EntityID>{id});
+}
@@ -0,0 +1,89 @@
+#include "../util.hpp"
+
+#include "../../engine/geometry/transform.hpp"
+#include "../../engine/scene/prefab.hpp"
+using namespace engine;
+using namespace engine::architecture;
+using namespace engine::scene;
+
+static auto create_node(ECS& ecs, EntityID parent) -> EntityID {
+  auto e = ecs.create();
+  ecs.emplace<component::Node>(e);
+  if (parent != NullEntityID)
+    attach(ecs, parent, e);
+  return e;
+}
+
+TEST(PrefabTest, Instantiates1) {
+  ECS ecs;
+  auto root  = create_node(ecs, NullEntityID);
+  auto cube  = create_node(ecs, root);
+  auto left  = create_node(ecs, cube);
+  auto right = create_node(ecs, cube);
+  create_node(ecs, left);
+  ecs.emplace<geometry::Transform>(right, geometry::Vector<3>(1.0F, 2.0F, 3.0F));
+
+  auto prefab = Prefab::capture<geometry::Transform>(ecs, cube);
+  EXPECT_EQ(prefab.size(), 4U);
+
+  auto roots = prefab.instantiate(ecs, root, 3);
+  ASSERT_EQ(roots.size(), 3U);
+  EXPECT_EQ(ecs.size<component::Node>(), 1U + 4U * 4U);
+  EXPECT_EQ(ecs.size<geometry::Transform>(), 4U);
+  EXPECT_EQ(ecs.get<component::Node>(root).child_count, 4U);
+
+  for (auto copy : roots) {
+    const auto& copy_node = ecs.get<component::Node>(copy);
+    EXPECT_EQ(copy_node.parent, root);
+    EXPECT_EQ(copy_node.depth, 1U);
+    EXPECT_EQ(copy_node.child_count, 2U);
+
+    auto copy_left  = copy_node.first_child;
+    auto copy_right = copy_node.last_child;
+    EXPECT_EQ(ecs.get<component::Node>(copy_left).next_sibling, copy_right);
+    EXPECT_EQ(ecs.get<component::Node>(copy_right).prev_sibling, copy_left);
+    EXPECT_EQ(ecs.get<component::Node>(copy_left).parent, copy);
+    EXPECT_EQ(ecs.get<component::Node>(ecs.get<component::Node>(copy_left).first_child).depth, 3U);
+
+    EXPECT_FALSE(ecs.has<geometry::Transform>(copy_left));
+    EXPECT_EQ(ecs.get<geometry::Transform>(copy_right).position(), geometry::Vector<3>(1.0F, 2.0F, 3.0F));
+  }
+}
+
+static std::vector<geometry::Transform> destroyed_transforms;
+
+static void record_destroyed_transform(ECS& ecs, EntityID e) {
+  destroyed_transforms.push_back(ecs.get<geometry::Transform>(e));
+}
+
+TEST(PrefabTest, Migrates1) {
+  ECS from;
+  auto from_root = create_node(from, NullEntityID);
+  auto section   = create_node(from, from_root);
+  auto a         = create_node(from, section);
+  auto b         = create_node(from, a);
+  from.emplace<geometry::Transform>(b, geometry::Vector<3>(1.0F, 2.0F, 3.0F));
+
+  ECS to;
+  auto to_root = create_node(to, NullEntityID);
+  create_node(to, to_root);
+
+  // Listeners in the source registry must only see moved-from components.
+  destroyed_transforms.clear();
+  from.on_destroy<geometry::Transform>().connect<&record_destroyed_transform>();
+
+  auto moved = migrate<geometry::Transform>(from, section, to, to_root);
+
+  EXPECT_EQ(from.size<component::Node>(), 1U);
+  EXPECT_EQ(from.get<component::Node>(from_root).child_count, 0U);
+  ASSERT_EQ(destroyed_transforms.size(), 1U);
+  EXPECT_EQ(destroyed_transforms[0], geometry::Transform());
+
+  EXPECT_EQ(to.size<component::Node>(), 5U);
+  EXPECT_EQ(to.get<component::Node>(to_root).last_child, moved);
+  EXPECT_EQ(to.get<component::Node>(moved).depth, 1U);
+
+  auto moved_b = to.get<component::Node>(to.get<component::Node>(moved).first_child).first_child;
+  EXPECT_EQ(to.get<component::Node>(moved_b).depth, 3U);
+  EXPECT_EQ(to.get<geometry::Transform>(moved_b).position(), geometry::Vector<3>(1.0F, 2.0F, 3.0F));
+}
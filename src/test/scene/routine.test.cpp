@@ -0,0 +1,79 @@
+#include "../util.hpp"
+
+#include "../../engine/scene/routine.hpp"
+
+using namespace engine::scene;
+
+TEST(RoutineSchedulerTest, NextTick1) {
+  RoutineScheduler routines;
+
+  int resumes = 0;
+  routines.start([&resumes] {
+    resumes++;
+    return resumes < 3 ? Wait::next_tick() : Wait::done();
+  });
+  EXPECT_EQ(resumes, 1);
+  EXPECT_EQ(routines.size(), 1U);
+
+  routines.update(0.1F);
+  EXPECT_EQ(resumes, 2);
+  routines.update(0.1F);
+  EXPECT_EQ(resumes, 3);
+  EXPECT_EQ(routines.size(), 0U);
+
+  routines.update(0.1F);
+  EXPECT_EQ(resumes, 3);
+}
+
+TEST(RoutineSchedulerTest, Seconds1) {
+  RoutineScheduler routines;
+  std::vector<int> order;
+
+  // Each routine resumes once, after its wait.
+  for (int i : {2, 1, 3}) {
+    routines.start([&order, i, started = false]() mutable {
+      if (started) {
+        order.push_back(i);
+        return Wait::done();
+      }
+      started = true;
+      return Wait::seconds((float) i);
+    });
+  }
+
+  routines.update(0.5F);
+  EXPECT_TRUE(order.empty());
+  routines.update(1.0F);
+  EXPECT_EQ(order, (std::vector<int>{1}));
+  routines.update(2.0F);
+  EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(routines.size(), 0U);
+}
+
+TEST(RoutineSchedulerTest, Until1) {
+  RoutineScheduler routines;
+
+  bool ready = false;
+  int step   = 0;
+  routines.start([&] {
+    switch (step++) {
+    case 0:
+      return Wait::until([&ready] { return ready; });
+    case 1:
+      return Wait::seconds(0.0F);
+    default:
+      return Wait::done();
+    }
+  });
+
+  routines.update(1.0F);
+  EXPECT_EQ(step, 1);
+
+  // A routine whose new wait is already over still waits for the next update.
+  ready = true;
+  routines.update(1.0F);
+  EXPECT_EQ(step, 2);
+  routines.update(0.0F);
+  EXPECT_EQ(step, 3);
+  EXPECT_EQ(routines.size(), 0U);
+}
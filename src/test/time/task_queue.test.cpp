@@ -0,0 +1,57 @@
+#include "../util.hpp"
+
+#include "../../engine/time/task_queue.hpp"
+
+#include <thread>
+
+using namespace engine::time;
+
+TEST(TaskQueueTest, Runs1) {
+  TaskQueue tasks(std::chrono::seconds(10));
+
+  std::vector<int> order;
+  tasks.push("first", [&order, steps = 0]() mutable {
+    order.push_back(1);
+    return ++steps == 3;
+  });
+  tasks.push("second", [&order] {
+    order.push_back(2);
+    return true;
+  });
+  EXPECT_EQ(tasks.size(), 2U);
+
+  // A generous budget finishes all tasks in one run, oldest first.
+  tasks.run();
+  EXPECT_EQ(order, (std::vector<int>{1, 1, 1, 2}));
+  EXPECT_EQ(tasks.size(), 0U);
+  EXPECT_EQ(tasks.overruns(), 0U);
+}
+
+TEST(TaskQueueTest, Budgets1) {
+  TaskQueue tasks(std::chrono::nanoseconds::zero());
+
+  int steps = 0;
+  tasks.push("task", [&steps] { return ++steps == 2; });
+
+  // Without budget, each run still makes progress with a single step.
+  tasks.run();
+  EXPECT_EQ(steps, 1);
+  tasks.run();
+  EXPECT_EQ(steps, 2);
+  EXPECT_EQ(tasks.size(), 0U);
+}
+
+TEST(TaskQueueTest, Overruns1) {
+  TaskQueue tasks(std::chrono::milliseconds(1));
+
+  int steps = 0;
+  tasks.push("slow", [&steps] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    return ++steps == 2;
+  });
+
+  tasks.run();
+  EXPECT_EQ(steps, 1);
+  EXPECT_EQ(tasks.overruns(), 1U);
+  EXPECT_GE(tasks.last_run_time(), std::chrono::milliseconds(2));
+}
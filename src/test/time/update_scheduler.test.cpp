@@ -0,0 +1,228 @@
+#include "../util.hpp"
+
+#include "../../engine/time/update_scheduler.hpp"
+
+#include <algorithm>
+
+using namespace engine::time;
+
+namespace {
+
+  /// Only advances while the scheduler waits, or when a test advances it, so that the timings of a run are exact.
+  struct FakeClock {
+    static constexpr std::chrono::nanoseconds spin_step = std::chrono::microseconds(100); //< how much a single yield advances the time
+
+    std::chrono::steady_clock::time_point time;
+    std::chrono::nanoseconds slept = std::chrono::nanoseconds::zero();
+    std::chrono::nanoseconds spun  = std::chrono::nanoseconds::zero();
+    unsigned int sleeps            = 0;
+
+    auto clock() -> UpdateScheduler::Clock {
+      return {
+        [this] { return time; },
+        [this](std::chrono::steady_clock::time_point deadline) {
+          sleeps++;
+          slept += deadline - time;
+          time = std::max(time, deadline);
+        },
+        [this] {
+          spun += spin_step;
+          time += spin_step;
+        },
+      };
+    }
+  };
+
+}
+
+TEST(UpdateSchedulerTest, Runs1) {
+  std::atomic<bool> running = true;
+  unsigned int fixed_ticks  = 0;
+  std::vector<float> variable_dts;
+
+  std::vector<UpdateScheduler::Schedule> schedules;
+  schedules.push_back({[&](float dt) {
+                         EXPECT_FLOAT_EQ(dt, 0.005F);
+                         if (++fixed_ticks == 40)
+                           running = false;
+                       },
+                       std::chrono::milliseconds(5),
+                       true});
+  schedules.push_back({[&](float dt) { variable_dts.push_back(dt); },
+                       std::chrono::milliseconds(20),
+                       false});
+  FakeClock clock;
+  UpdateScheduler scheduler(std::move(schedules), std::chrono::microseconds(500), clock.clock());
+  scheduler.run(running);
+
+  // Variable schedules get the time since they last ran.
+  EXPECT_EQ(fixed_ticks, 40U);
+  EXPECT_EQ(variable_dts, std::vector<float>(10, 0.02F));
+
+  // The scheduler sleeps between updates, and only spins for the spin margin before each of them.
+  EXPECT_EQ(clock.sleeps, 41U);
+  EXPECT_EQ(clock.spun, clock.sleeps * std::chrono::microseconds(500));
+  EXPECT_EQ(clock.slept + clock.spun, std::chrono::milliseconds(205));
+}
+
+TEST(UpdateSchedulerTest, Runs2) {
+  // The real clock is used by default.
+  std::atomic<bool> running = true;
+  unsigned int ticks        = 0;
+
+  std::vector<UpdateScheduler::Schedule> schedules;
+  schedules.push_back({[&](float) {
+                         if (++ticks == 3)
+                           running = false;
+                       },
+                       std::chrono::milliseconds(1),
+                       true});
+  UpdateScheduler scheduler(std::move(schedules));
+
+  auto start = std::chrono::steady_clock::now();
+  scheduler.run(running);
+  EXPECT_EQ(ticks, 3U);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(3));
+}
+
+TEST(UpdateSchedulerTest, CatchesUp1) {
+  std::atomic<bool> running = true;
+  std::vector<unsigned int> steps_per_iteration;
+  unsigned int steps = 0;
+  FakeClock clock;
+
+  // The first step takes as long as 20 steps, so the schedule falls far behind.
+  std::vector<UpdateScheduler::Schedule> schedules;
+  schedules.push_back({[&](float) { steps_per_iteration.push_back(0); }, std::chrono::nanoseconds::zero()});
+  schedules.push_back({[&](float) {
+                         if (++steps == 1)
+                           clock.time += std::chrono::milliseconds(40);
+                         steps_per_iteration.back()++;
+                         if (steps == 4)
+                           running = false;
+                       },
+                       std::chrono::milliseconds(2),
+                       true,
+                       false,
+                       3,
+                       UpdateScheduler::Overflow::DROP});
+  UpdateScheduler scheduler(std::move(schedules), std::chrono::microseconds(500), clock.clock());
+  scheduler.run(running);
+
+  // The 40 ms behind make up 20 steps, of which 3 run and the other 17 are dropped.
+  EXPECT_EQ(steps_per_iteration, (std::vector<unsigned int>{0, 1, 3}));
+  EXPECT_EQ(scheduler.dropped_ticks(), 17U);
+}
+
+TEST(UpdateSchedulerTest, CatchesUp2) {
+  std::atomic<bool> running = true;
+  std::vector<unsigned int> steps_per_iteration;
+  unsigned int steps = 0;
+  FakeClock clock;
+
+  // Carried steps are made up in the following iterations instead.
+  std::vector<UpdateScheduler::Schedule> schedules;
+  schedules.push_back({[&](float) { steps_per_iteration.push_back(0); }, std::chrono::nanoseconds::zero()});
+  schedules.push_back({[&](float) {
+                         if (++steps == 1)
+                           clock.time += std::chrono::milliseconds(10);
+                         steps_per_iteration.back()++;
+                         if (steps == 6)
+                           running = false;
+                       },
+                       std::chrono::milliseconds(2),
+                       true,
+                       false,
+                       3,
+                       UpdateScheduler::Overflow::CARRY});
+  UpdateScheduler scheduler(std::move(schedules), std::chrono::microseconds(500), clock.clock());
+  scheduler.run(running);
+
+  EXPECT_EQ(steps_per_iteration, (std::vector<unsigned int>{0, 1, 3, 2}));
+  EXPECT_EQ(scheduler.dropped_ticks(), 0U);
+}
+
+TEST(UpdateSchedulerTest, Scales1) {
+  std::atomic<bool> running = true;
+  unsigned int unscaled     = 0;
+  std::vector<float> scaled_dts;
+
+  std::vector<UpdateScheduler::Schedule> schedules;
+  schedules.push_back({[&](float) {
+                         if (++unscaled == 20)
+                           running = false;
+                       },
+                       std::chrono::milliseconds(2),
+                       true});
+  schedules.push_back({[&](float dt) { scaled_dts.push_back(dt); }, std::chrono::milliseconds(2), true, true});
+  FakeClock clock;
+  UpdateScheduler scheduler(std::move(schedules), std::chrono::microseconds(500), clock.clock());
+
+  // In slow motion, scaled schedules keep their step size and run less often.
+  scheduler.set_time_scale(0.5F);
+  scheduler.run(running);
+  EXPECT_EQ(unscaled, 20U);
+  EXPECT_EQ(scaled_dts, std::vector<float>(10, 0.002F));
+}
+
+TEST(UpdateSchedulerTest, Scales2) {
+  std::atomic<bool> running = true;
+  unsigned int unscaled     = 0;
+  unsigned int scaled       = 0;
+
+  std::vector<UpdateScheduler::Schedule> schedules;
+  schedules.push_back({[&](float) {
+                         if (++unscaled == 20)
+                           running = false;
+                       },
+                       std::chrono::milliseconds(2),
+                       true});
+  schedules.push_back({[&](float) { scaled++; }, std::chrono::milliseconds(2), true, true});
+  FakeClock clock;
+  UpdateScheduler scheduler(std::move(schedules), std::chrono::microseconds(500), clock.clock());
+
+  // Paused schedules don't run, and don't make the others spin.
+  scheduler.set_time_scale(0.0F);
+  scheduler.run(running);
+  EXPECT_EQ(unscaled, 20U);
+  EXPECT_EQ(scaled, 0U);
+  EXPECT_EQ(clock.spun, clock.sleeps * std::chrono::microseconds(500));
+}
+
+TEST(UpdateSchedulerTest, Interpolates1) {
+  std::atomic<bool> running      = true;
+  UpdateScheduler* scheduler_ptr = nullptr;
+  std::vector<float> interpolations;
+  FakeClock clock;
+
+  // The first step takes longer than two steps, so the second one lags behind real time.
+  std::vector<UpdateScheduler::Schedule> schedules;
+  schedules.push_back({[&](float) {
+                         interpolations.push_back(scheduler_ptr->interpolation(0));
+                         if (interpolations.size() == 1)
+                           clock.time += std::chrono::milliseconds(12);
+                         if (interpolations.size() == 4)
+                           running = false;
+                       },
+                       std::chrono::milliseconds(5),
+                       true,
+                       true});
+  schedules.push_back({[](float) {}, std::chrono::milliseconds(5), true});
+  UpdateScheduler scheduler(std::move(schedules), std::chrono::microseconds(500), clock.clock());
+  scheduler_ptr = &scheduler;
+  scheduler.run(running);
+
+  // The second step runs 7 ms after it was due, and the third one 2 ms.
+  ASSERT_EQ(interpolations.size(), 4U);
+  EXPECT_FLOAT_EQ(interpolations[0], 0.0F);
+  EXPECT_FLOAT_EQ(interpolations[1], 1.4F);
+  EXPECT_FLOAT_EQ(interpolations[2], 0.4F);
+  EXPECT_FLOAT_EQ(interpolations[3], 0.0F);
+
+  // Only scaled schedules take longer in slow motion.
+  scheduler.set_time_scale(0.5F);
+  EXPECT_EQ(scheduler.step_interval(0), std::chrono::milliseconds(10));
+  EXPECT_EQ(scheduler.step_interval(1), std::chrono::milliseconds(5));
+  scheduler.set_time_scale(0.0F);
+  EXPECT_EQ(scheduler.step_interval(0), std::chrono::milliseconds(5));
+}